@@ -0,0 +1,189 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test damage (dirty rectangle) tracker
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "damage.h"
+
+
+static inline size_t damage_rectarea(const damage_rect_t *r)
+{
+	return (size_t)r->w * r->h;
+}
+
+
+static void damage_union(const damage_rect_t *a, const damage_rect_t *b, damage_rect_t *u)
+{
+	unsigned int x = (a->x < b->x) ? a->x : b->x, y = (a->y < b->y) ? a->y : b->y;
+	unsigned int ex = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+	unsigned int ey = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+
+	u->x = x;
+	u->y = y;
+	u->w = ex - x;
+	u->h = ey - y;
+}
+
+
+/* Returns pixels that merging a and b would needlessly commit, negative if they overlap enough to save some */
+static long damage_waste(const damage_rect_t *a, const damage_rect_t *b)
+{
+	damage_rect_t u;
+
+	damage_union(a, b, &u);
+
+	return (long)damage_rectarea(&u) - (long)damage_rectarea(a) - (long)damage_rectarea(b);
+}
+
+
+static int damage_overlap(const damage_rect_t *a, const damage_rect_t *b)
+{
+	return (a->x < b->x + b->w) && (b->x < a->x + a->w) && (a->y < b->y + b->h) && (b->y < a->y + a->h);
+}
+
+
+static void damage_remove(damage_t *damage, unsigned int i)
+{
+	damage->rects[i] = damage->rects[--damage->n];
+}
+
+
+void damage_init(damage_t *damage, unsigned int width, unsigned int height)
+{
+	damage->width = width;
+	damage->height = height;
+	damage->n = 0;
+}
+
+
+void damage_clear(damage_t *damage)
+{
+	damage->n = 0;
+}
+
+
+void damage_add(damage_t *damage, int x, int y, int w, int h)
+{
+	damage_rect_t r, m;
+	unsigned int i, j, best = 0;
+	long waste, bestw;
+
+	/* Clip to screen */
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (x + w > (int)damage->width)
+		w = damage->width - x;
+	if (y + h > (int)damage->height)
+		h = damage->height - y;
+	if ((w <= 0) || (h <= 0))
+		return;
+
+	r.x = x;
+	r.y = y;
+	r.w = w;
+	r.h = h;
+
+	/*
+	 * Absorb rectangles as long as union doesn't cost more than committing them separately.
+	 * Overlapping ones are always absorbed, so rectangles stay disjoint and no pixel is counted twice
+	 */
+	for (i = 0; i < damage->n;) {
+		if (damage_overlap(&r, &damage->rects[i]) || (damage_waste(&r, &damage->rects[i]) <= 0)) {
+			damage_union(&r, &damage->rects[i], &r);
+			damage_remove(damage, i);
+			i = 0;
+		}
+		else {
+			i++;
+		}
+	}
+
+	if (damage->n < DAMAGE_MAXRECTS) {
+		damage->rects[damage->n++] = r;
+		return;
+	}
+
+	/* List is full, merge the cheapest pair (new rectangle included) */
+	bestw = damage_waste(&r, &damage->rects[0]);
+	for (i = 1; i < damage->n; i++) {
+		if ((waste = damage_waste(&r, &damage->rects[i])) < bestw) {
+			bestw = waste;
+			best = i;
+		}
+	}
+
+	for (i = 0; i < damage->n; i++) {
+		for (j = i + 1; j < damage->n; j++) {
+			if ((waste = damage_waste(&damage->rects[i], &damage->rects[j])) < bestw) {
+				bestw = waste;
+				best = DAMAGE_MAXRECTS + i * DAMAGE_MAXRECTS + j;
+			}
+		}
+	}
+
+	if (best < DAMAGE_MAXRECTS) {
+		damage_union(&r, &damage->rects[best], &r);
+		damage_remove(damage, best);
+	}
+	else {
+		i = (best - DAMAGE_MAXRECTS) / DAMAGE_MAXRECTS;
+		j = (best - DAMAGE_MAXRECTS) % DAMAGE_MAXRECTS;
+		damage_union(&damage->rects[i], &damage->rects[j], &m);
+		damage_remove(damage, j);
+		damage_remove(damage, i);
+
+		/* Merged pair may overlap others, add it back to absorb them */
+		damage_add(damage, m.x, m.y, m.w, m.h);
+	}
+
+	/* Merged rectangle may now absorb others */
+	damage_add(damage, r.x, r.y, r.w, r.h);
+}
+
+
+size_t damage_area(const damage_t *damage)
+{
+	size_t area = 0;
+	unsigned int i;
+
+	for (i = 0; i < damage->n; i++)
+		area += damage_rectarea(&damage->rects[i]);
+
+	return area;
+}
+
+
+size_t damage_commit(const damage_t *damage, const graph_t *graph, void *dst)
+{
+	const damage_rect_t *r;
+	size_t offs, bytes = 0;
+	unsigned int i, j;
+
+	for (i = 0; i < damage->n; i++) {
+		r = &damage->rects[i];
+
+		for (j = 0; j < r->h; j++) {
+			offs = graph->depth * ((size_t)(r->y + j) * graph->width + r->x);
+			memcpy((unsigned char *)dst + offs, (const unsigned char *)graph->data + offs, r->w * graph->depth);
+		}
+		bytes += damage_rectarea(r) * graph->depth;
+	}
+
+	return bytes;
+}
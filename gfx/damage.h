@@ -0,0 +1,58 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test damage (dirty rectangle) tracker
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _DAMAGE_H_
+#define _DAMAGE_H_
+
+#include <stddef.h>
+
+#include <graph.h>
+
+
+#define DAMAGE_MAXRECTS 16 /* Damaged rectangles kept before forced merging */
+
+
+typedef struct {
+	unsigned int x;
+	unsigned int y;
+	unsigned int w;
+	unsigned int h;
+} damage_rect_t;
+
+
+typedef struct {
+	unsigned int width;  /* Screen width */
+	unsigned int height; /* Screen height */
+	unsigned int n;      /* Number of damaged rectangles */
+	damage_rect_t rects[DAMAGE_MAXRECTS];
+} damage_t;
+
+
+extern void damage_init(damage_t *damage, unsigned int width, unsigned int height);
+
+
+extern void damage_clear(damage_t *damage);
+
+
+/* Records damaged area clipped to screen, coalescing it with overlapping or adjacent rectangles so they stay disjoint */
+extern void damage_add(damage_t *damage, int x, int y, int w, int h);
+
+
+/* Returns damaged area in pixels */
+extern size_t damage_area(const damage_t *damage);
+
+
+/* Copies damaged rectangles of graph framebuffer to dst with the same geometry, returns copied bytes */
+extern size_t damage_commit(const damage_t *damage, const graph_t *graph, void *dst);
+
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test framebuffer fill and move kernels
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fbkern.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+#define FBKERN_VECSZ 16
+#else
+#define FBKERN_VECSZ sizeof(unsigned long)
+#endif
+
+
+static inline void fbkern_put(uint8_t *p, unsigned char depth, uint32_t color)
+{
+	switch (depth) {
+		case 1:
+			*p = color;
+			break;
+
+		case 2:
+			*(uint16_t *)p = color;
+			break;
+
+		default:
+			*(uint32_t *)p = color;
+			break;
+	}
+}
+
+
+void fbkern_fillref(void *dst, size_t n, unsigned char depth, uint32_t color)
+{
+	uint8_t *p = dst;
+
+	for (; n > 0; n--, p += depth)
+		fbkern_put(p, depth, color);
+}
+
+
+void fbkern_moveref(void *dst, const void *src, size_t n, unsigned char depth)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+	size_t i, j;
+
+	if (d <= s) {
+		for (i = 0; i < n * depth; i += depth) {
+			for (j = 0; j < depth; j++)
+				d[i + j] = s[i + j];
+		}
+	}
+	else {
+		for (i = n * depth; i > 0; i -= depth) {
+			for (j = depth; j > 0; j--)
+				d[i - depth + j - 1] = s[i - depth + j - 1];
+		}
+	}
+}
+
+
+void fbkern_fill(void *dst, size_t n, unsigned char depth, uint32_t color)
+{
+	uint8_t *p = dst;
+	uint32_t pat;
+	size_t i, len;
+#ifdef __SSE2__
+	__m128i v;
+#else
+	unsigned long v;
+#endif
+
+	/* Head pixels up to vector alignment, never reached if pixels aren't naturally aligned */
+	for (; n > 0 && ((uintptr_t)p & (FBKERN_VECSZ - 1)) != 0; n--, p += depth)
+		fbkern_put(p, depth, color);
+
+	/* Vector size is a multiple of pixel size, so aligned blocks start at the same pattern phase */
+	switch (depth) {
+		case 1:
+			pat = (color & 0xff) * 0x01010101u;
+			break;
+
+		case 2:
+			pat = (color & 0xffff) * 0x00010001u;
+			break;
+
+		default:
+			pat = color;
+			break;
+	}
+	len = (n * depth) & ~(size_t)(FBKERN_VECSZ - 1);
+
+#ifdef __SSE2__
+	v = _mm_set1_epi32(pat);
+	for (i = 0; i + 4 * FBKERN_VECSZ <= len; i += 4 * FBKERN_VECSZ) {
+		_mm_store_si128((__m128i *)(p + i), v);
+		_mm_store_si128((__m128i *)(p + i + 16), v);
+		_mm_store_si128((__m128i *)(p + i + 32), v);
+		_mm_store_si128((__m128i *)(p + i + 48), v);
+	}
+	for (; i < len; i += FBKERN_VECSZ)
+		_mm_store_si128((__m128i *)(p + i), v);
+#else
+	v = pat;
+	if (sizeof(v) > sizeof(pat))
+		v |= (v << 16) << 16;
+	for (i = 0; i < len; i += FBKERN_VECSZ)
+		memcpy(p + i, &v, sizeof(v));
+#endif
+
+	p += len;
+	n -= len / depth;
+
+	/* Tail pixels */
+	for (; n > 0; n--, p += depth)
+		fbkern_put(p, depth, color);
+}
+
+
+static void fbkern_forward(uint8_t *d, const uint8_t *s, size_t len)
+{
+	size_t i;
+#ifdef __SSE2__
+	__m128i v0, v1, v2, v3;
+#else
+	unsigned long v;
+#endif
+
+	for (; len > 0 && ((uintptr_t)d & (FBKERN_VECSZ - 1)) != 0; len--)
+		*d++ = *s++;
+
+	/* Whole block is loaded before it's stored, so stores never hit source bytes still to be read */
+#ifdef __SSE2__
+	for (i = 0; i + 4 * FBKERN_VECSZ <= len; i += 4 * FBKERN_VECSZ) {
+		v0 = _mm_loadu_si128((const __m128i *)(s + i));
+		v1 = _mm_loadu_si128((const __m128i *)(s + i + 16));
+		v2 = _mm_loadu_si128((const __m128i *)(s + i + 32));
+		v3 = _mm_loadu_si128((const __m128i *)(s + i + 48));
+		_mm_store_si128((__m128i *)(d + i), v0);
+		_mm_store_si128((__m128i *)(d + i + 16), v1);
+		_mm_store_si128((__m128i *)(d + i + 32), v2);
+		_mm_store_si128((__m128i *)(d + i + 48), v3);
+	}
+	for (; i + FBKERN_VECSZ <= len; i += FBKERN_VECSZ) {
+		v0 = _mm_loadu_si128((const __m128i *)(s + i));
+		_mm_store_si128((__m128i *)(d + i), v0);
+	}
+#else
+	for (i = 0; i + FBKERN_VECSZ <= len; i += FBKERN_VECSZ) {
+		memcpy(&v, s + i, sizeof(v));
+		memcpy(d + i, &v, sizeof(v));
+	}
+#endif
+
+	for (; i < len; i++)
+		d[i] = s[i];
+}
+
+
+static void fbkern_backward(uint8_t *d, const uint8_t *s, size_t len)
+{
+#ifdef __SSE2__
+	__m128i v0, v1, v2, v3;
+#else
+	unsigned long v;
+#endif
+
+	d += len;
+	s += len;
+
+	for (; len > 0 && ((uintptr_t)d & (FBKERN_VECSZ - 1)) != 0; len--)
+		*--d = *--s;
+
+#ifdef __SSE2__
+	for (; len >= 4 * FBKERN_VECSZ; len -= 4 * FBKERN_VECSZ) {
+		d -= 4 * FBKERN_VECSZ;
+		s -= 4 * FBKERN_VECSZ;
+		v3 = _mm_loadu_si128((const __m128i *)(s + 48));
+		v2 = _mm_loadu_si128((const __m128i *)(s + 32));
+		v1 = _mm_loadu_si128((const __m128i *)(s + 16));
+		v0 = _mm_loadu_si128((const __m128i *)s);
+		_mm_store_si128((__m128i *)(d + 48), v3);
+		_mm_store_si128((__m128i *)(d + 32), v2);
+		_mm_store_si128((__m128i *)(d + 16), v1);
+		_mm_store_si128((__m128i *)d, v0);
+	}
+	for (; len >= FBKERN_VECSZ; len -= FBKERN_VECSZ) {
+		d -= FBKERN_VECSZ;
+		s -= FBKERN_VECSZ;
+		v0 = _mm_loadu_si128((const __m128i *)s);
+		_mm_store_si128((__m128i *)d, v0);
+	}
+#else
+	for (; len >= FBKERN_VECSZ; len -= FBKERN_VECSZ) {
+		d -= FBKERN_VECSZ;
+		s -= FBKERN_VECSZ;
+		memcpy(&v, s, sizeof(v));
+		memcpy(d, &v, sizeof(v));
+	}
+#endif
+
+	while (len-- > 0)
+		*--d = *--s;
+}
+
+
+void fbkern_move(void *dst, const void *src, size_t n, unsigned char depth)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	/* Copy away from the overlap, byte order within pixels doesn't matter then */
+	if ((d <= s) || (d >= s + n * depth))
+		fbkern_forward(d, s, n * depth);
+	else
+		fbkern_backward(d, s, n * depth);
+}
+
+
+const char *fbkern_impl(void)
+{
+#ifdef __SSE2__
+	return "sse2";
+#else
+	return "generic";
+#endif
+}
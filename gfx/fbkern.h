@@ -0,0 +1,39 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test framebuffer fill and move kernels
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _FBKERN_H_
+#define _FBKERN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* Reference kernels, one pixel at a time */
+extern void fbkern_fillref(void *dst, size_t n, unsigned char depth, uint32_t color);
+
+
+extern void fbkern_moveref(void *dst, const void *src, size_t n, unsigned char depth);
+
+
+/* Fills n pixels of depth bytes each with color, SSE2 or word at a time */
+extern void fbkern_fill(void *dst, size_t n, unsigned char depth, uint32_t color);
+
+
+/* Moves n pixels of depth bytes each, source and destination may overlap */
+extern void fbkern_move(void *dst, const void *src, size_t n, unsigned char depth);
+
+
+/* Returns name of compiled in vector implementation */
+extern const char *fbkern_impl(void);
+
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test glyph cache and batched text rendering
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fbkern.h"
+#include "glyph.h"
+
+
+/* Converts glyph bitmap rows to spans of set pixels, scaled the same way as memfb_print */
+static uint16_t *glyph_expand(glyph_cache_t *cache, unsigned char idx)
+{
+	const graph_font_t *font = cache->font;
+	const unsigned char *bits = font->data + idx * font->span * font->height;
+	unsigned int i, j, fx, fy, n = cache->h + 1, start;
+	uint16_t *glyph;
+	int set, prev;
+
+	/* Row of w pixels has at most (w + 1) / 2 spans */
+	if ((glyph = malloc((cache->h + 1 + cache->h * (cache->w + 1)) * sizeof(*glyph))) == NULL)
+		return NULL;
+
+	for (j = 0; j < cache->h; j++) {
+		glyph[j] = n;
+		fy = j * font->height / cache->h;
+
+		for (i = 0, prev = 0, start = 0; i <= cache->w; i++, prev = set) {
+			set = 0;
+			if (i < cache->w) {
+				fx = i * font->width / cache->w;
+				set = (bits[fy * font->span + fx / 8] & (1 << (fx % 8))) != 0;
+			}
+
+			if (set && !prev) {
+				start = i;
+			}
+			else if (!set && prev) {
+				glyph[n++] = start;
+				glyph[n++] = i - start;
+			}
+		}
+	}
+	glyph[cache->h] = n;
+
+	cache->misses++;
+
+	return glyph;
+}
+
+
+int glyph_cacheinit(glyph_cache_t *cache, const graph_font_t *font, unsigned char dx, unsigned char dy)
+{
+	memset(cache, 0, sizeof(*cache));
+
+	cache->font = font;
+	cache->w = font->width * dx / font->height;
+	cache->h = dy;
+
+	/* Span offsets have to fit in 16 bits */
+	if ((cache->w == 0) || (cache->h == 0) || (cache->h + 1 + cache->h * (cache->w + 1) > UINT16_MAX))
+		return -EINVAL;
+
+	return EOK;
+}
+
+
+void glyph_cachedone(glyph_cache_t *cache)
+{
+	unsigned int i;
+
+	for (i = 0; i < GLYPH_COUNT; i++) {
+		free(cache->glyphs[i]);
+		cache->glyphs[i] = NULL;
+	}
+}
+
+
+int glyph_print(graph_t *graph, glyph_cache_t *cache, const char *text, unsigned int x, unsigned int y, unsigned int color)
+{
+	const uint16_t *batch[GLYPH_BATCH], *g;
+	unsigned char *line;
+	unsigned char idx;
+	unsigned int i, j, k, n;
+
+	for (;;) {
+		/* Look up batch of glyphs that fit on screen, expanding missing ones */
+		for (n = 0; (n < GLYPH_BATCH) && (text[n] != '\0') && (x + (n + 1) * cache->w <= graph->width); n++) {
+			idx = text[n] - cache->font->offs;
+			if ((cache->glyphs[idx] == NULL) && ((cache->glyphs[idx] = glyph_expand(cache, idx)) == NULL))
+				return -ENOMEM;
+			batch[n] = cache->glyphs[idx];
+		}
+
+		if (n == 0)
+			return EOK;
+
+		/* Draw whole batch one framebuffer line at a time */
+		for (j = 0; (j < cache->h) && (y + j < graph->height); j++) {
+			line = (unsigned char *)graph->data + graph->depth * ((y + j) * graph->width + x);
+
+			for (i = 0; i < n; i++, line += cache->w * graph->depth) {
+				g = batch[i];
+				for (k = g[j]; k < g[j + 1]; k += 2)
+					fbkern_fill(line + g[k] * graph->depth, g[k + 1], graph->depth, color);
+			}
+		}
+
+		text += n;
+		x += n * cache->w;
+	}
+}
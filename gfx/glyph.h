@@ -0,0 +1,45 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test glyph cache and batched text rendering
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _GLYPH_H_
+#define _GLYPH_H_
+
+#include <stdint.h>
+
+#include <graph.h>
+
+
+#define GLYPH_COUNT 256 /* Cached glyphs, indexed like font data by (unsigned char)(c - font->offs) */
+#define GLYPH_BATCH 128 /* Characters rendered in one framebuffer pass */
+
+
+typedef struct {
+	const graph_font_t *font;
+	unsigned int w;                /* Scaled glyph width */
+	unsigned int h;                /* Scaled glyph height */
+	uint16_t *glyphs[GLYPH_COUNT]; /* Expanded on first use: h + 1 row offsets into (x, len) span pairs that follow */
+	unsigned int misses;           /* Number of expanded glyphs */
+} glyph_cache_t;
+
+
+/* Prepares cache of font glyphs scaled like memfb_print/graph_print with dx and dy */
+extern int glyph_cacheinit(glyph_cache_t *cache, const graph_font_t *font, unsigned char dx, unsigned char dy);
+
+
+extern void glyph_cachedone(glyph_cache_t *cache);
+
+
+/* Renders whole string line by line into memory framebuffer, output matches memfb_print */
+extern int glyph_print(graph_t *graph, glyph_cache_t *cache, const char *text, unsigned int x, unsigned int y, unsigned int color);
+
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test 8-bit run-length encoded logo
+ *
+ * Generated by logoenc.py from logo8.h, do not edit
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _LOGO8_RLE_H_
+#define _LOGO8_RLE_H_
+
+
+/* Logo color map (RGB) */
+static const unsigned char cmap[2][3] = {
+	{ 0xf9, 0x42, 0x3a },
+	{ 0xff, 0xff, 0xff }
+};
+
+
+/* 200x150 8-bit Phoenix-RTOS logo, 30000 bytes raw */
+static const unsigned char logo8_rle[1454] = {
+	0xb2, 0x00, 0x9f, 0x01, 0x9c, 0x00, 0x9f, 0x01, 0xe1, 0x00, 0xa8, 0x01, 0x94, 0x00, 0xa8, 0x01,
+	0xdb, 0x00, 0xaa, 0x01, 0x92, 0x00, 0xaa, 0x01, 0xd8, 0x00, 0xad, 0x01, 0x90, 0x00, 0xad, 0x01,
+	0xd5, 0x00, 0xae, 0x01, 0x90, 0x00, 0xae, 0x01, 0xd2, 0x00, 0xb1, 0x01, 0x8e, 0x00, 0xb1, 0x01,
+	0xcf, 0x00, 0xb2, 0x01, 0x8e, 0x00, 0xb2, 0x01, 0xcd, 0x00, 0xb4, 0x01, 0x8c, 0x00, 0xb4, 0x01,
+	0xcc, 0x00, 0xb4, 0x01, 0x8c, 0x00, 0xb4, 0x01, 0xcb, 0x00, 0xb5, 0x01, 0x8c, 0x00, 0xb5, 0x01,
+	0xc9, 0x00, 0xb6, 0x01, 0x8c, 0x00, 0xb6, 0x01, 0xc8, 0x00, 0xb6, 0x01, 0x8c, 0x00, 0xb6, 0x01,
+	0xc8, 0x00, 0xb5, 0x01, 0x8e, 0x00, 0xb5, 0x01, 0xc7, 0x00, 0xb6, 0x01, 0x8e, 0x00, 0xb6, 0x01,
+	0xc6, 0x00, 0xb6, 0x01, 0x8e, 0x00, 0xb6, 0x01, 0xc6, 0x00, 0xb5, 0x01, 0x90, 0x00, 0xb5, 0x01,
+	0xc6, 0x00, 0xb5, 0x01, 0x90, 0x00, 0xb5, 0x01, 0xc5, 0x00, 0xb4, 0x01, 0x94, 0x00, 0xb4, 0x01,
+	0xc4, 0x00, 0xb3, 0x01, 0x96, 0x00, 0xb3, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xa7, 0x00, 0x8d, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x8d, 0x01, 0x88, 0x00, 0x8f, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x8f, 0x01, 0x85, 0x00, 0x90, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x90, 0x01, 0x83, 0x00, 0x91, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x91, 0x01, 0x81, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x00, 0x00, 0x93, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x93, 0x01, 0x00, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0x81, 0x00, 0x91, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x91, 0x01, 0x83, 0x00, 0x90, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x90, 0x01, 0x85, 0x00, 0x8f, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x8f, 0x01, 0x88, 0x00, 0x8d, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x8d, 0x01, 0xa7, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0xc4, 0x00, 0x91, 0x01, 0xda, 0x00, 0x91, 0x01, 0xc3, 0x00, 0x92, 0x01, 0xda, 0x00, 0x92, 0x01,
+	0xc2, 0x00, 0x92, 0x01, 0xda, 0x00, 0x92, 0x01, 0xc1, 0x00, 0x93, 0x01, 0xda, 0x00, 0x93, 0x01,
+	0xbf, 0x00, 0x94, 0x01, 0xdb, 0x00, 0x93, 0x01, 0xbc, 0x00, 0x95, 0x01, 0xdc, 0x00, 0x95, 0x01,
+	0xa4, 0x00, 0xab, 0x01, 0xdc, 0x00, 0xab, 0x01, 0x8b, 0x00, 0xae, 0x01, 0xdc, 0x00, 0xae, 0x01,
+	0x86, 0x00, 0xaf, 0x01, 0xde, 0x00, 0xaf, 0x01, 0x83, 0x00, 0xb0, 0x01, 0xde, 0x00, 0xb0, 0x01,
+	0x81, 0x00, 0xb0, 0x01, 0xe0, 0x00, 0xb0, 0x01, 0x80, 0x00, 0xb0, 0x01, 0xe0, 0x00, 0xb0, 0x01,
+	0x80, 0x00, 0xaf, 0x01, 0xe2, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xaf, 0x01, 0xe4, 0x00, 0xdf, 0x01,
+	0xe6, 0x00, 0xde, 0x01, 0xe7, 0x00, 0xdc, 0x01, 0xe8, 0x00, 0xdd, 0x01, 0xe6, 0x00, 0xdf, 0x01,
+	0xe4, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xaf, 0x01, 0xe2, 0x00, 0xaf, 0x01, 0x80, 0x00, 0xaf, 0x01,
+	0xe1, 0x00, 0xb0, 0x01, 0x80, 0x00, 0xb0, 0x01, 0xe0, 0x00, 0xb0, 0x01, 0x81, 0x00, 0xaf, 0x01,
+	0xdf, 0x00, 0xb0, 0x01, 0x83, 0x00, 0xaf, 0x01, 0xde, 0x00, 0xaf, 0x01, 0x86, 0x00, 0xae, 0x01,
+	0xdc, 0x00, 0xae, 0x01, 0x8b, 0x00, 0xab, 0x01, 0xdc, 0x00, 0xab, 0x01, 0xa4, 0x00, 0x95, 0x01,
+	0xdc, 0x00, 0x95, 0x01, 0xbc, 0x00, 0x93, 0x01, 0xdb, 0x00, 0x94, 0x01, 0xbf, 0x00, 0x93, 0x01,
+	0xda, 0x00, 0x93, 0x01, 0xc1, 0x00, 0x92, 0x01, 0xda, 0x00, 0x92, 0x01, 0xc2, 0x00, 0x92, 0x01,
+	0xda, 0x00, 0x92, 0x01, 0xc3, 0x00, 0x91, 0x01, 0xda, 0x00, 0x91, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xa7, 0x00, 0x8d, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x8d, 0x01, 0x88, 0x00, 0x8f, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x8f, 0x01, 0x85, 0x00, 0x90, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x90, 0x01, 0x83, 0x00, 0x91, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x91, 0x01, 0x81, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x00, 0x00, 0x93, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0x8c, 0x00, 0xa8, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x93, 0x01, 0x00, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x80, 0x00, 0x92, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x92, 0x01, 0x81, 0x00, 0x91, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x91, 0x01, 0x83, 0x00, 0x90, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x90, 0x01, 0x85, 0x00, 0x8f, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x8f, 0x01, 0x88, 0x00, 0x8d, 0x01, 0x8c, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01,
+	0x8c, 0x00, 0x8d, 0x01, 0xa7, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01, 0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0x92, 0x01,
+	0xd8, 0x00, 0x92, 0x01, 0xc4, 0x00, 0xb3, 0x01, 0x96, 0x00, 0xb3, 0x01, 0xc4, 0x00, 0xb4, 0x01,
+	0x94, 0x00, 0xb4, 0x01, 0xc5, 0x00, 0xb5, 0x01, 0x90, 0x00, 0xb5, 0x01, 0xc6, 0x00, 0xb5, 0x01,
+	0x90, 0x00, 0xb5, 0x01, 0xc6, 0x00, 0xb6, 0x01, 0x8e, 0x00, 0xb6, 0x01, 0xc6, 0x00, 0xb6, 0x01,
+	0x8e, 0x00, 0xb6, 0x01, 0xc7, 0x00, 0xb5, 0x01, 0x8e, 0x00, 0xb5, 0x01, 0xc8, 0x00, 0xb6, 0x01,
+	0x8c, 0x00, 0xb6, 0x01, 0xc8, 0x00, 0xb6, 0x01, 0x8c, 0x00, 0xb6, 0x01, 0xc9, 0x00, 0xb5, 0x01,
+	0x8c, 0x00, 0xb5, 0x01, 0xcb, 0x00, 0xb4, 0x01, 0x8c, 0x00, 0xb4, 0x01, 0xcc, 0x00, 0xb4, 0x01,
+	0x8c, 0x00, 0xb4, 0x01, 0xcd, 0x00, 0xb2, 0x01, 0x8e, 0x00, 0xb2, 0x01, 0xcf, 0x00, 0xb1, 0x01,
+	0x8e, 0x00, 0xb1, 0x01, 0xd2, 0x00, 0xae, 0x01, 0x90, 0x00, 0xae, 0x01, 0xd5, 0x00, 0xad, 0x01,
+	0x90, 0x00, 0xad, 0x01, 0xd7, 0x00, 0xab, 0x01, 0x92, 0x00, 0xab, 0x01, 0xda, 0x00, 0xa8, 0x01,
+	0x94, 0x00, 0xa8, 0x01, 0xe1, 0x00, 0x9f, 0x01, 0x9c, 0x00, 0x9f, 0x01, 0xb2, 0x00
+};
+
+
+#endif
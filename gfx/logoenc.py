@@ -0,0 +1,165 @@
+#! /usr/bin/env python3
+#
+# Phoenix-RTOS
+#
+# Graphics library test logo encoder
+#
+# Converts raw logoXX.h pixel arrays to run-length encoded logoXX_rle.h headers
+# decoded by rle.c. Encoded format is a sequence of packets, each starting with
+# header byte h:
+#   h < 0x80  - h + 1 literal pixels follow
+#   h >= 0x80 - (h & 0x7f) + 2 repetitions of single following pixel
+# Pixels are stored in framebuffer byte order, depth bytes each.
+#
+# Copyright 2021 Phoenix Systems
+#
+# %LICENSE%
+#
+
+import argparse
+import re
+import sys
+
+
+LOGO_WIDTH = 200
+LOGO_HEIGHT = 150
+
+MAX_LITERAL = 0x80
+MAX_RUN = 0x81
+
+HEADER = """/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test {bits}-bit run-length encoded logo
+ *
+ * Generated by logoenc.py from logo{bits}.h, do not edit
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _LOGO{bits}_RLE_H_
+#define _LOGO{bits}_RLE_H_
+
+"""
+
+
+def parse_header(path):
+    """Returns dict of array name to its bytes for all arrays defined in C header"""
+    with open(path) as f:
+        text = f.read()
+
+    arrays = {}
+    for m in re.finditer(r"static const unsigned char (\w+)((?:\[\d+\])+) = \{(.*?)\};", text, re.S):
+        arrays[m.group(1)] = bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", m.group(3)))
+
+    return arrays
+
+
+def encode(data, depth):
+    pixels = [data[i:i + depth] for i in range(0, len(data), depth)]
+    out = bytearray()
+    literal = []
+    i = 0
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            for p in literal:
+                out.extend(p)
+            literal.clear()
+
+    while i < len(pixels):
+        n = 1
+        while i + n < len(pixels) and n < MAX_RUN and pixels[i + n] == pixels[i]:
+            n += 1
+
+        if n >= 2:
+            flush()
+            out.append(0x80 | (n - 2))
+            out.extend(pixels[i])
+            i += n
+        else:
+            literal.append(pixels[i])
+            if len(literal) == MAX_LITERAL:
+                flush()
+            i += 1
+
+    flush()
+
+    return bytes(out)
+
+
+def decode(data, depth):
+    out = bytearray()
+    i = 0
+
+    while i < len(data):
+        h = data[i]
+        i += 1
+        if h < 0x80:
+            out.extend(data[i:i + (h + 1) * depth])
+            i += (h + 1) * depth
+        else:
+            out.extend(data[i:i + depth] * ((h & 0x7f) + 2))
+            i += depth
+
+    return bytes(out)
+
+
+def format_cmap(data):
+    lines = ["/* Logo color map (RGB) */", "static const unsigned char cmap[{}][3] = {{".format(len(data) // 3)]
+    for i in range(0, len(data), 3):
+        lines.append("\t{ " + ", ".join("0x{:02x}".format(b) for b in data[i:i + 3]) + (" }," if i + 3 < len(data) else " }"))
+    lines.append("};")
+
+    return "\n".join(lines) + "\n"
+
+
+def format_array(name, data, comment):
+    lines = ["/* {} */".format(comment), "static const unsigned char {}[{}] = {{".format(name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x{:02x}".format(b) for b in data[i:i + 16]) + ("," if i + 16 < len(data) else ""))
+    lines.append("};")
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run-length encodes graphics test logo")
+    parser.add_argument("bits", type=int, choices=[8, 16, 24, 32], help="logo color depth in bits")
+    parser.add_argument("input", help="raw logo header (logoXX.h)")
+    parser.add_argument("output", help="encoded logo header (logoXX_rle.h)")
+    args = parser.parse_args()
+
+    depth = args.bits // 8
+    arrays = parse_header(args.input)
+    name = "logo{}".format(args.bits)
+
+    if name not in arrays or len(arrays[name]) != LOGO_WIDTH * LOGO_HEIGHT * depth:
+        print("logoenc: {} doesn't contain {}x{} {}".format(args.input, LOGO_WIDTH, LOGO_HEIGHT, name), file=sys.stderr)
+        return 1
+
+    raw = arrays[name]
+    rle = encode(raw, depth)
+    if decode(rle, depth) != raw:
+        print("logoenc: {} round trip failed".format(name), file=sys.stderr)
+        return 1
+
+    with open(args.output, "w") as f:
+        f.write(HEADER.format(bits=args.bits))
+        if "cmap" in arrays:
+            f.write("\n" + format_cmap(arrays["cmap"]) + "\n")
+        f.write("\n" + format_array(name + "_rle", rle, "{}x{} {}-bit Phoenix-RTOS logo, {} bytes raw".format(LOGO_WIDTH, LOGO_HEIGHT, args.bits, len(raw))))
+        f.write("\n\n#endif\n")
+
+    print("logoenc: {} {} -> {} bytes ({:.1f}%)".format(name, len(raw), len(rle), 100.0 * len(rle) / len(raw)))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,398 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test memory framebuffer
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fbkern.h"
+#include "memfb.h"
+
+
+static struct {
+	unsigned char cmap[256][3];
+	unsigned char amask[MEMFB_CURSORSZ][MEMFB_CURSORSZ / 8];
+	unsigned char xmask[MEMFB_CURSORSZ][MEMFB_CURSORSZ / 8];
+	unsigned int bg;
+	unsigned int fg;
+	unsigned int x;
+	unsigned int y;
+	int visible;
+	uint32_t under[MEMFB_CURSORSZ * MEMFB_CURSORSZ];
+} memfb_common;
+
+
+static inline void *memfb_addr(graph_t *graph, unsigned int x, unsigned int y)
+{
+	return (void *)((uintptr_t)graph->data + graph->depth * (y * graph->width + x));
+}
+
+
+static inline void memfb_pixel(graph_t *graph, unsigned int x, unsigned int y, unsigned int color)
+{
+	void *p = memfb_addr(graph, x, y);
+
+	switch (graph->depth) {
+		case 1:
+			*(uint8_t *)p = color;
+			break;
+
+		case 2:
+			*(uint16_t *)p = color;
+			break;
+
+		case 4:
+			*(uint32_t *)p = color;
+			break;
+	}
+}
+
+
+static inline unsigned int memfb_get(graph_t *graph, unsigned int x, unsigned int y)
+{
+	void *p = memfb_addr(graph, x, y);
+
+	switch (graph->depth) {
+		case 1:
+			return *(uint8_t *)p;
+
+		case 2:
+			return *(uint16_t *)p;
+
+		default:
+			return *(uint32_t *)p;
+	}
+}
+
+
+/* Converts 8:8:8:8 ARGB color to framebuffer format, nearest color map entry for 8-bit */
+static unsigned int memfb_color(graph_t *graph, unsigned int argb)
+{
+	unsigned int r = (argb >> 16) & 0xff, g = (argb >> 8) & 0xff, b = argb & 0xff, i, d, best = 0, bestd = ~0u;
+
+	switch (graph->depth) {
+		case 1:
+			for (i = 0; i < 256; i++) {
+				d = abs((int)memfb_common.cmap[i][0] - (int)r) + abs((int)memfb_common.cmap[i][1] - (int)g) + abs((int)memfb_common.cmap[i][2] - (int)b);
+				if (d < bestd) {
+					bestd = d;
+					best = i;
+				}
+			}
+			return best;
+
+		case 2:
+			return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+
+		default:
+			return argb;
+	}
+}
+
+
+/* Clips rectangle to screen, returns 0 if nothing is left */
+static int memfb_clip(graph_t *graph, int *x, int *y, int *dx, int *dy)
+{
+	if (*x < 0) {
+		*dx += *x;
+		*x = 0;
+	}
+
+	if (*y < 0) {
+		*dy += *y;
+		*y = 0;
+	}
+
+	if (*x + *dx > (int)graph->width)
+		*dx = graph->width - *x;
+
+	if (*y + *dy > (int)graph->height)
+		*dy = graph->height - *y;
+
+	return (*dx > 0) && (*dy > 0);
+}
+
+
+int memfb_open(graph_t *graph, unsigned int width, unsigned int height, unsigned char depth)
+{
+	if ((depth != 1) && (depth != 2) && (depth != 4))
+		return -EINVAL;
+
+	memset(graph, 0, sizeof(*graph));
+
+	if ((graph->data = calloc(width * height, depth)) == NULL)
+		return -ENOMEM;
+
+	graph->width = width;
+	graph->height = height;
+	graph->depth = depth;
+	memfb_common.visible = 0;
+
+	return EOK;
+}
+
+
+void memfb_close(graph_t *graph)
+{
+	free(graph->data);
+	graph->data = NULL;
+}
+
+
+int memfb_line(graph_t *graph, unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color)
+{
+	int sx = (dx < 0) ? -1 : 1, sy = (dy < 0) ? -1 : 1;
+	int ax = abs(dx), ay = abs(dy), err = ax - ay, e2;
+	int cx = x, cy = y, ex = x + dx, ey = y + dy;
+	unsigned int i, j;
+
+	if (stroke == 0)
+		return -EINVAL;
+
+	/* Bresenham's algorithm, stroke extends right and down */
+	for (;;) {
+		for (i = 0; i < stroke; i++) {
+			for (j = 0; j < stroke; j++) {
+				if ((cx + i < graph->width) && (cy + j < graph->height) && (cx >= 0) && (cy >= 0))
+					memfb_pixel(graph, cx + i, cy + j, color);
+			}
+		}
+
+		if ((cx == ex) && (cy == ey))
+			break;
+
+		e2 = 2 * err;
+		if (e2 > -ay) {
+			err -= ay;
+			cx += sx;
+		}
+		if (e2 < ax) {
+			err += ax;
+			cy += sy;
+		}
+	}
+
+	return EOK;
+}
+
+
+int memfb_rect(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color)
+{
+	int cx = x, cy = y, cdx = dx, cdy = dy;
+
+	if (!memfb_clip(graph, &cx, &cy, &cdx, &cdy))
+		return EOK;
+
+	/* memset keeps up with the fill kernel for bytes, the kernel only pays off for wider pixels (see test_fbkern -b) */
+	while (cdy--) {
+		if (graph->depth == 1)
+			memset(memfb_addr(graph, cx, cy++), color, cdx);
+		else
+			fbkern_fill(memfb_addr(graph, cx, cy++), cdx, graph->depth, color);
+	}
+
+	return EOK;
+}
+
+
+int memfb_move(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	int sx = x, sy = y, tx = x + mx, ty = y + my, w = dx, h = dy, i;
+
+	/* Clip source and destination, keeping them aligned */
+	if (!memfb_clip(graph, &sx, &sy, &w, &h))
+		return EOK;
+	tx = sx + mx;
+	ty = sy + my;
+	if (!memfb_clip(graph, &tx, &ty, &w, &h))
+		return EOK;
+	sx = tx - mx;
+	sy = ty - my;
+
+	/* Rows are copied away from the overlap, memmove is not slower than the move kernel (see test_fbkern -b) */
+	if (my > 0) {
+		for (i = h - 1; i >= 0; i--)
+			memmove(memfb_addr(graph, tx, ty + i), memfb_addr(graph, sx, sy + i), w * graph->depth);
+	}
+	else {
+		for (i = 0; i < h; i++)
+			memmove(memfb_addr(graph, tx, ty + i), memfb_addr(graph, sx, sy + i), w * graph->depth);
+	}
+
+	return EOK;
+}
+
+
+int memfb_copy(graph_t *graph, const void *src, void *dst, unsigned int dx, unsigned int dy, unsigned int srcspan, unsigned int dstspan)
+{
+	while (dy--) {
+		memcpy(dst, src, dx * graph->depth);
+		src = (const void *)((uintptr_t)src + srcspan);
+		dst = (void *)((uintptr_t)dst + dstspan);
+	}
+
+	return EOK;
+}
+
+
+int memfb_print(graph_t *graph, const graph_font_t *font, const char *text, unsigned int x, unsigned int y, unsigned char dx, unsigned char dy, unsigned int color)
+{
+	unsigned int w = font->width * dx / font->height, h = dy, i, j, fx, fy;
+	const unsigned char *glyph;
+
+	if ((w == 0) || (h == 0))
+		return -EINVAL;
+
+	/* Glyphs are scaled to dy height, bits are LSB first */
+	for (; *text != '\0' && x + w <= graph->width; text++, x += w) {
+		glyph = font->data + (unsigned char)(*text - font->offs) * font->span * font->height;
+
+		for (j = 0; j < h && y + j < graph->height; j++) {
+			fy = j * font->height / h;
+			for (i = 0; i < w; i++) {
+				fx = i * font->width / w;
+				if (glyph[fy * font->span + fx / 8] & (1 << (fx % 8)))
+					memfb_pixel(graph, x + i, y + j, color);
+			}
+		}
+	}
+
+	return EOK;
+}
+
+
+int memfb_colorset(graph_t *graph, const unsigned char *colors, unsigned char first, unsigned char last)
+{
+	if (first > last)
+		return -EINVAL;
+
+	memcpy(memfb_common.cmap[first], colors, 3 * (last - first + 1));
+
+	return EOK;
+}
+
+
+int memfb_colorget(graph_t *graph, unsigned char *colors, unsigned char first, unsigned char last)
+{
+	if (first > last)
+		return -EINVAL;
+
+	memcpy(colors, memfb_common.cmap[first], 3 * (last - first + 1));
+
+	return EOK;
+}
+
+
+/* Draws cursor at its position, saving covered pixels */
+static void memfb_cursordraw(graph_t *graph)
+{
+	unsigned int i, j, a, x, p;
+
+	for (j = 0; j < MEMFB_CURSORSZ && memfb_common.y + j < graph->height; j++) {
+		for (i = 0; i < MEMFB_CURSORSZ && memfb_common.x + i < graph->width; i++) {
+			p = memfb_get(graph, memfb_common.x + i, memfb_common.y + j);
+			memfb_common.under[j * MEMFB_CURSORSZ + i] = p;
+
+			/* AND mask set keeps (or with XOR mask inverts) the screen, cleared selects cursor color */
+			a = memfb_common.amask[j][i / 8] & (0x80 >> (i % 8));
+			x = memfb_common.xmask[j][i / 8] & (0x80 >> (i % 8));
+			if (!a)
+				memfb_pixel(graph, memfb_common.x + i, memfb_common.y + j, x ? memfb_common.fg : memfb_common.bg);
+			else if (x)
+				memfb_pixel(graph, memfb_common.x + i, memfb_common.y + j, ~p);
+		}
+	}
+}
+
+
+static void memfb_cursorerase(graph_t *graph)
+{
+	unsigned int i, j;
+
+	for (j = 0; j < MEMFB_CURSORSZ && memfb_common.y + j < graph->height; j++) {
+		for (i = 0; i < MEMFB_CURSORSZ && memfb_common.x + i < graph->width; i++)
+			memfb_pixel(graph, memfb_common.x + i, memfb_common.y + j, memfb_common.under[j * MEMFB_CURSORSZ + i]);
+	}
+}
+
+
+int memfb_cursorset(graph_t *graph, const unsigned char *amask, const unsigned char *xmask, unsigned int bg, unsigned int fg)
+{
+	if (memfb_common.visible)
+		memfb_cursorerase(graph);
+
+	memcpy(memfb_common.amask, amask, sizeof(memfb_common.amask));
+	memcpy(memfb_common.xmask, xmask, sizeof(memfb_common.xmask));
+	memfb_common.bg = memfb_color(graph, bg);
+	memfb_common.fg = memfb_color(graph, fg);
+
+	if (memfb_common.visible)
+		memfb_cursordraw(graph);
+
+	return EOK;
+}
+
+
+int memfb_cursorpos(graph_t *graph, unsigned int x, unsigned int y)
+{
+	if ((x >= graph->width) || (y >= graph->height))
+		return -EINVAL;
+
+	if (memfb_common.visible)
+		memfb_cursorerase(graph);
+
+	memfb_common.x = x;
+	memfb_common.y = y;
+
+	if (memfb_common.visible)
+		memfb_cursordraw(graph);
+
+	return EOK;
+}
+
+
+int memfb_cursorshow(graph_t *graph)
+{
+	if (!memfb_common.visible) {
+		memfb_cursordraw(graph);
+		memfb_common.visible = 1;
+	}
+
+	return EOK;
+}
+
+
+int memfb_cursorhide(graph_t *graph)
+{
+	if (memfb_common.visible) {
+		memfb_cursorerase(graph);
+		memfb_common.visible = 0;
+	}
+
+	return EOK;
+}
+
+
+uint32_t memfb_checksum(graph_t *graph)
+{
+	const unsigned char *p = graph->data;
+	size_t i, n = (size_t)graph->width * graph->height * graph->depth;
+	uint32_t hash = 2166136261u;
+
+	for (i = 0; i < n; i++) {
+		hash ^= p[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
@@ -0,0 +1,70 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test memory framebuffer
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _MEMFB_H_
+#define _MEMFB_H_
+
+#include <stdint.h>
+
+#include <graph.h>
+
+
+#define MEMFB_CURSORSZ 64 /* Cursor side, masks are MEMFB_CURSORSZ rows of MEMFB_CURSORSZ / 8 bytes */
+
+
+/* Sets up graph with malloc'ed framebuffer, only geometry fields are used */
+extern int memfb_open(graph_t *graph, unsigned int width, unsigned int height, unsigned char depth);
+
+
+extern void memfb_close(graph_t *graph);
+
+
+/* Primitives below follow libgraph semantics, but draw synchronously */
+extern int memfb_line(graph_t *graph, unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color);
+
+
+extern int memfb_rect(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color);
+
+
+extern int memfb_move(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my);
+
+
+extern int memfb_copy(graph_t *graph, const void *src, void *dst, unsigned int dx, unsigned int dy, unsigned int srcspan, unsigned int dstspan);
+
+
+extern int memfb_print(graph_t *graph, const graph_font_t *font, const char *text, unsigned int x, unsigned int y, unsigned char dx, unsigned char dy, unsigned int color);
+
+
+extern int memfb_colorset(graph_t *graph, const unsigned char *colors, unsigned char first, unsigned char last);
+
+
+extern int memfb_colorget(graph_t *graph, unsigned char *colors, unsigned char first, unsigned char last);
+
+
+/* Software cursor, drawn into framebuffer with saved background */
+extern int memfb_cursorset(graph_t *graph, const unsigned char *amask, const unsigned char *xmask, unsigned int bg, unsigned int fg);
+
+
+extern int memfb_cursorpos(graph_t *graph, unsigned int x, unsigned int y);
+
+
+extern int memfb_cursorshow(graph_t *graph);
+
+
+extern int memfb_cursorhide(graph_t *graph);
+
+
+/* Returns FNV-1a hash of framebuffer contents */
+extern uint32_t memfb_checksum(graph_t *graph);
+
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test run-length encoded image decoder
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fbkern.h"
+#include "rle.h"
+
+
+uint32_t rle_pixel(const unsigned char *src, unsigned char depth)
+{
+	uint16_t p16;
+	uint32_t p32;
+
+	/* Pixel bytes are in framebuffer order */
+	switch (depth) {
+		case 1:
+			return src[1];
+
+		case 2:
+			memcpy(&p16, src + 1, sizeof(p16));
+			return p16;
+
+		default:
+			memcpy(&p32, src + 1, sizeof(p32));
+			return p32;
+	}
+}
+
+
+int rle_decode(const unsigned char *src, size_t srcsz, void *dst, unsigned int dx, unsigned int dy, unsigned int dstspan, unsigned char depth)
+{
+	const unsigned char *end = src + srcsz;
+	unsigned char *line = dst;
+	unsigned int x = 0, n, len;
+	uint32_t color = 0;
+	int run;
+
+	if ((depth != 1) && (depth != 2) && (depth != 4))
+		return -EINVAL;
+
+	while ((src < end) && (dy > 0)) {
+		run = *src & 0x80;
+		n = run ? (*src & 0x7f) + 2 : *src + 1;
+		src++;
+
+		if (src + (run ? 1 : n) * depth > end)
+			return -EINVAL;
+
+		if (run) {
+			color = rle_pixel(src - 1, depth);
+			src += depth;
+		}
+
+		/* Packets may span multiple lines */
+		while ((n > 0) && (dy > 0)) {
+			len = (n < dx - x) ? n : dx - x;
+
+			if (run) {
+				fbkern_fill(line + x * depth, len, depth, color);
+			}
+			else {
+				memcpy(line + x * depth, src, len * depth);
+				src += len * depth;
+			}
+
+			n -= len;
+			if ((x += len) == dx) {
+				x = 0;
+				line += dstspan;
+				dy--;
+			}
+		}
+
+		/* Image ended in the middle of packet */
+		if (n > 0)
+			return -EINVAL;
+	}
+
+	return ((src == end) && (dy == 0)) ? EOK : -EINVAL;
+}
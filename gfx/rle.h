@@ -0,0 +1,28 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test run-length encoded image decoder
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _RLE_H_
+#define _RLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* Returns first pixel of encoded image (see logoenc.py for format) */
+extern uint32_t rle_pixel(const unsigned char *src, unsigned char depth);
+
+
+/* Decodes image straight into dx x dy framebuffer area with dstspan bytes per line */
+extern int rle_decode(const unsigned char *src, size_t srcsz, void *dst, unsigned int dx, unsigned int dy, unsigned int dstspan, unsigned char depth);
+
+
+#endif
@@ -0,0 +1,268 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test framebuffer fill and move kernels test
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fbkern.h"
+#include "../test_common.h"
+
+
+#define TEST_FBKERN_BUFSZ  4096  /* Verification buffer size */
+#define TEST_FBKERN_EDGE   64    /* Exhaustive offsets and lengths sweep limit */
+#define TEST_FBKERN_EDGESZ 512   /* Buffer part used by exhaustive sweep */
+#define TEST_FBKERN_ROUNDS 20000 /* Randomized verification rounds */
+#define TEST_FBKERN_WIDTH  1024  /* Benchmark screen width */
+#define TEST_FBKERN_HEIGHT 768   /* Benchmark screen height */
+#define TEST_FBKERN_FRAMES 32    /* Benchmark frames per measurement */
+#define TEST_FBKERN_STEP   8     /* Scroll step in pixels */
+
+
+/* Benchmarked screen operations */
+enum { op_fill = 0, op_scrollup, op_scrollright, op_scrollleft, op_count };
+
+
+static const char *op_names[] = { "fill", "scroll up", "scroll right", "scroll left" };
+
+
+/* Benchmarked implementations, libc stands for memset and memmove */
+enum { impl_scalar = 0, impl_libc, impl_kern };
+
+
+static const unsigned char depths[] = { 1, 2, 4 };
+
+
+static struct {
+	unsigned char ref[TEST_FBKERN_BUFSZ] __attribute__((aligned(64)));
+	unsigned char buf[TEST_FBKERN_BUFSZ] __attribute__((aligned(64)));
+	unsigned char pattern[2 * TEST_FBKERN_BUFSZ];
+	unsigned int size; /* Compared buffer part */
+	unsigned int seed;
+	unsigned int failed;
+} test_fbkern_common;
+
+
+static void test_fbkern_randomize(void)
+{
+	const unsigned char *p = test_fbkern_common.pattern + rand_r(&test_fbkern_common.seed) % TEST_FBKERN_BUFSZ;
+
+	memcpy(test_fbkern_common.ref, p, test_fbkern_common.size);
+	memcpy(test_fbkern_common.buf, p, test_fbkern_common.size);
+}
+
+
+/* Compares whole buffer part, so writes outside of operated range are caught too */
+static void test_fbkern_compare(const char *op, unsigned char depth, size_t dst, size_t src, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < test_fbkern_common.size; i++) {
+		if (test_fbkern_common.ref[i] != test_fbkern_common.buf[i])
+			break;
+	}
+
+	if (i == test_fbkern_common.size)
+		return;
+
+	if (test_fbkern_common.failed++ < 10) {
+		printf("test_fbkern: %s depth %u dst %zu src %zu n %zu differs at byte %zu (%02x != %02x)\n",
+			op, depth, dst, src, n, i, test_fbkern_common.buf[i], test_fbkern_common.ref[i]);
+	}
+}
+
+
+static void test_fbkern_fill(unsigned char depth, size_t dst, size_t n)
+{
+	uint32_t color = rand_r(&test_fbkern_common.seed);
+
+	test_fbkern_randomize();
+	fbkern_fillref(test_fbkern_common.ref + dst, n, depth, color);
+	fbkern_fill(test_fbkern_common.buf + dst, n, depth, color);
+	test_fbkern_compare("fill", depth, dst, 0, n);
+}
+
+
+static void test_fbkern_move(unsigned char depth, size_t dst, size_t src, size_t n)
+{
+	test_fbkern_randomize();
+	fbkern_moveref(test_fbkern_common.ref + dst, test_fbkern_common.ref + src, n, depth);
+	fbkern_move(test_fbkern_common.buf + dst, test_fbkern_common.buf + src, n, depth);
+	test_fbkern_compare("move", depth, dst, src, n);
+}
+
+
+static int test_fbkern_verify(unsigned int seed)
+{
+	size_t off, n, dst, src, max;
+	unsigned int i, d;
+	unsigned char depth;
+	int dist;
+
+	printf("test_fbkern: %s kernels verification, seed = %u\n", fbkern_impl(), seed);
+
+	test_fbkern_common.seed = seed;
+	test_fbkern_common.failed = 0;
+
+	for (i = 0; i < sizeof(test_fbkern_common.pattern); i++)
+		test_fbkern_common.pattern[i] = rand_r(&test_fbkern_common.seed);
+
+	/* All head alignments, lengths and short overlap distances around vector size */
+	test_fbkern_common.size = TEST_FBKERN_EDGESZ;
+	for (d = 0; d < sizeof(depths); d++) {
+		depth = depths[d];
+
+		for (off = 0; off < TEST_FBKERN_EDGE; off += depth) {
+			for (n = 0; n < TEST_FBKERN_EDGE; n++) {
+				test_fbkern_fill(depth, off, n);
+
+				for (dist = -TEST_FBKERN_EDGE / 2; dist <= TEST_FBKERN_EDGE / 2; dist += depth)
+					test_fbkern_move(depth, TEST_FBKERN_EDGE + off + dist, TEST_FBKERN_EDGE + off, n);
+			}
+		}
+	}
+
+	/* Long runs with random placement */
+	test_fbkern_common.size = TEST_FBKERN_BUFSZ;
+	for (i = 0; i < TEST_FBKERN_ROUNDS; i++) {
+		depth = depths[rand_r(&test_fbkern_common.seed) % sizeof(depths)];
+		max = TEST_FBKERN_BUFSZ / depth;
+		n = rand_r(&test_fbkern_common.seed) % max;
+		dst = rand_r(&test_fbkern_common.seed) % (max - n + 1);
+		src = rand_r(&test_fbkern_common.seed) % (max - n + 1);
+
+		if (i & 1)
+			test_fbkern_fill(depth, dst * depth, n);
+		else
+			test_fbkern_move(depth, dst * depth, src * depth, n);
+	}
+
+	printf("test_fbkern: %s\n", test_fbkern_common.failed ? "FAILED" : "PASSED");
+
+	return test_fbkern_common.failed ? 1 : 0;
+}
+
+
+static void test_fbkern_libcfill(void *dst, size_t n, unsigned char depth, uint32_t color)
+{
+	memset(dst, color, n * depth);
+}
+
+
+static void test_fbkern_libcmove(void *dst, const void *src, size_t n, unsigned char depth)
+{
+	memmove(dst, src, n * depth);
+}
+
+
+/* Runs one frame of op on screen, the way memfb draws it row by row */
+static void test_fbkern_frame(unsigned char *fb, unsigned char depth, int op, int impl, unsigned int frame)
+{
+	static void (*const fills[])(void *, size_t, unsigned char, uint32_t) = { fbkern_fillref, test_fbkern_libcfill, fbkern_fill };
+	static void (*const moves[])(void *, const void *, size_t, unsigned char) = { fbkern_moveref, test_fbkern_libcmove, fbkern_move };
+	const size_t span = TEST_FBKERN_WIDTH * depth, n = TEST_FBKERN_WIDTH - TEST_FBKERN_STEP;
+	const size_t step = TEST_FBKERN_STEP * depth;
+	void (*move)(void *, const void *, size_t, unsigned char) = moves[impl];
+	unsigned int y;
+
+	switch (op) {
+		case op_fill:
+			for (y = 0; y < TEST_FBKERN_HEIGHT; y++)
+				fills[impl](fb + y * span, TEST_FBKERN_WIDTH, depth, frame * 0x01020304u);
+			break;
+
+		case op_scrollup:
+			for (y = 0; y < TEST_FBKERN_HEIGHT - TEST_FBKERN_STEP; y++)
+				move(fb + y * span, fb + (y + TEST_FBKERN_STEP) * span, TEST_FBKERN_WIDTH, depth);
+			break;
+
+		case op_scrollright:
+			for (y = 0; y < TEST_FBKERN_HEIGHT; y++)
+				move(fb + y * span + step, fb + y * span, n, depth);
+			break;
+
+		case op_scrollleft:
+			for (y = 0; y < TEST_FBKERN_HEIGHT; y++)
+				move(fb + y * span, fb + y * span + step, n, depth);
+			break;
+	}
+}
+
+
+/* Returns average frame time in usec */
+static uint64_t test_fbkern_time(unsigned char *fb, unsigned char depth, int op, int impl)
+{
+	uint64_t t;
+	unsigned int i;
+
+	/* Warm up caches and page mappings */
+	test_fbkern_frame(fb, depth, op, impl, 0);
+
+	t = bench_time();
+	for (i = 0; i < TEST_FBKERN_FRAMES; i++)
+		test_fbkern_frame(fb, depth, op, impl, i);
+	t = bench_time() - t;
+
+	return (t + TEST_FBKERN_FRAMES / 2) / TEST_FBKERN_FRAMES;
+}
+
+
+static int test_fbkern_bench(void)
+{
+	uint64_t tref, tlibc, tkern;
+	unsigned char *fb;
+	unsigned int d;
+	int op;
+
+	if ((fb = malloc(TEST_FBKERN_WIDTH * TEST_FBKERN_HEIGHT * 4)) == NULL) {
+		printf("test_fbkern: failed to allocate framebuffer\n");
+		return 1;
+	}
+	memset(fb, 0x5a, TEST_FBKERN_WIDTH * TEST_FBKERN_HEIGHT * 4);
+
+	printf("test_fbkern: %ux%u screen, %u frames, scalar and libc vs %s kernels\n",
+		TEST_FBKERN_WIDTH, TEST_FBKERN_HEIGHT, TEST_FBKERN_FRAMES, fbkern_impl());
+
+	for (d = 0; d < sizeof(depths); d++) {
+		for (op = 0; op < op_count; op++) {
+			tref = test_fbkern_time(fb, depths[d], op, impl_scalar);
+			tkern = test_fbkern_time(fb, depths[d], op, impl_kern);
+
+			printf("test_fbkern/%ubpp %-12s: scalar %6" PRIu64 " us/frame, %s %6" PRIu64 " us/frame (%" PRIu64 " MB/s), speedup %" PRIu64 ".%02" PRIu64 "x",
+				depths[d] * 8, op_names[op], tref, fbkern_impl(), tkern,
+				(uint64_t)TEST_FBKERN_WIDTH * TEST_FBKERN_HEIGHT * depths[d] / (tkern ? tkern : 1),
+				tref / (tkern ? tkern : 1), (tref * 100 / (tkern ? tkern : 1)) % 100);
+
+			/* memset fills bytes only, so it has no multi-byte pixel fill to compare with */
+			if ((op != op_fill) || (depths[d] == 1)) {
+				tlibc = test_fbkern_time(fb, depths[d], op, impl_libc);
+				printf(", libc %6" PRIu64 " us/frame (%s)", tlibc, (tkern < tlibc) ? "kernel wins" : "libc wins");
+			}
+			printf("\n");
+		}
+	}
+
+	free(fb);
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		return test_fbkern_bench();
+
+	return test_fbkern_verify((argc > 1) ? strtoul(argv[1], NULL, 10) : (unsigned int)time(NULL));
+}
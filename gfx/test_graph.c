@@ -17,19 +17,222 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <graph.h>
 
 #include "cursor.h"
+#include "damage.h"
 #include "font.h"
-#include "logo8.h"
-#include "logo16.h"
-#include "logo32.h"
+#include "glyph.h"
+#include "logo8_rle.h"
+#include "logo16_rle.h"
+#include "logo32_rle.h"
+#include "memfb.h"
+#include "rle.h"
+#include "../test_common.h"
+
+
+#define BENCH_WIDTH  1024              /* Headless framebuffer width */
+#define BENCH_HEIGHT 768               /* Headless framebuffer height */
+#define BENCH_PIXELS (4 * 1024 * 1024) /* Pixels drawn per measurement */
+#define BENCH_MINOPS 16
+#define BENCH_MAXOPS 20000
+#define BENCH_MAXSZ  512
+#define LOGO_WIDTH   200               /* Logo width */
+#define LOGO_HEIGHT  150               /* Logo height */
+#define BENCH_FRAMES 200               /* Frames per damage tracking measurement */
+#define PACING_MAXFRAMES 4096          /* Frames recorded per test phase */
+#define BENCH_CURSORPOS 1000           /* Cursor moves per measurement */
+#define BENCH_CURSORSET 100            /* Cursor shape uploads per measurement */
+
+
+/* Benchmarked primitives */
+enum { prim_rect = 0, prim_line, prim_move, prim_copy, prim_print, prim_count };
+
+
+static const char *prim_names[] = { "rect", "line", "move", "copy", "print" };
+
+
+/* Rectangle, move and copy block side or line length in pixels, print draws size / 8 characters */
+static const unsigned int bench_sizes[] = { 8, 32, 128, 512 };
+
+
+/* Expected memory framebuffer checksums at 8, 16 and 32 bpp, regenerate only on intended drawing changes */
+static const struct {
+	const char *name;
+	uint32_t sum[3];
+} test_sums[] = {
+	{ "lines1", { 0x36543e54, 0xcaed587c, 0x516e3fb4 } },
+	{ "lines2", { 0xa339fd26, 0xa3af9bcf, 0x5d51f2cf } },
+	{ "rectangles", { 0x69455581, 0x8c049c6e, 0x524464e6 } },
+	{ "logo", { 0x192f7e5c, 0x57f5324a, 0x7d4346ea } },
+	{ "cursor", { 0x98c9639e, 0x710a08fe, 0xe8eb19e2 } },
+};
+
+
+static struct {
+	int mem;           /* Draw on memory framebuffer instead of libgraph adapter */
+	unsigned int seed; /* Random generator state */
+	damage_t *damage;  /* Records areas touched by drawing if set */
+	unsigned int cx;   /* Cursor position */
+	unsigned int cy;
+
+	/* Frame pacing of test_vtrigger() */
+	struct {
+		uint64_t last;                     /* Previous vsync time */
+		unsigned int n;                    /* Recorded frames */
+		unsigned int frames;               /* All frames, recorded or not */
+		unsigned int missed;               /* Vsyncs passed without committed frame */
+		unsigned int tasks;                /* Queued tasks sum */
+		unsigned int maxtasks;
+		uint64_t frame[PACING_MAXFRAMES];  /* Time between vsyncs frames were committed on */
+		uint64_t commit[PACING_MAXFRAMES]; /* graph_commit() latency */
+	} pacing;
+} test_graph_common;
+
+
+/* Same sequence with every libc, so memory framebuffer checksums are reproducible */
+static unsigned int test_rand(void)
+{
+	test_graph_common.seed = test_graph_common.seed * 1103515245 + 12345;
+
+	return (test_graph_common.seed >> 16) & 0x7fff;
+}
+
+
+static void test_damage(int x, int y, int w, int h)
+{
+	if (test_graph_common.damage != NULL)
+		damage_add(test_graph_common.damage, x, y, w, h);
+}
+
+
+static int test_line(graph_t *graph, unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color)
+{
+	test_damage((dx < 0) ? x + dx : x, (dy < 0) ? y + dy : y, abs(dx) + stroke, abs(dy) + stroke);
+
+	if (test_graph_common.mem)
+		return memfb_line(graph, x, y, dx, dy, stroke, color);
+	return graph_line(graph, x, y, dx, dy, stroke, color, GRAPH_QUEUE_HIGH);
+}
+
+
+static int test_rect(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color)
+{
+	test_damage(x, y, dx, dy);
+
+	if (test_graph_common.mem)
+		return memfb_rect(graph, x, y, dx, dy, color);
+	return graph_rect(graph, x, y, dx, dy, color, GRAPH_QUEUE_HIGH);
+}
+
+
+static int test_move(graph_t *graph, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	/* Source keeps its contents, only destination changes */
+	test_damage(x + mx, y + my, dx, dy);
+
+	if (test_graph_common.mem)
+		return memfb_move(graph, x, y, dx, dy, mx, my);
+	return graph_move(graph, x, y, dx, dy, mx, my, GRAPH_QUEUE_HIGH);
+}
+
+
+static int test_copy(graph_t *graph, const void *src, void *dst, unsigned int dx, unsigned int dy, unsigned int srcspan, unsigned int dstspan)
+{
+	size_t offs = ((uintptr_t)dst - (uintptr_t)graph->data) / graph->depth;
+
+	/* Copies into framebuffer with its own line span are tracked, anything else damages whole screen */
+	if (((uintptr_t)dst >= (uintptr_t)graph->data) && (offs < (size_t)graph->width * graph->height) && (dstspan == graph->depth * graph->width))
+		test_damage(offs % graph->width, offs / graph->width, dx, dy);
+	else
+		test_damage(0, 0, graph->width, graph->height);
+
+	if (test_graph_common.mem)
+		return memfb_copy(graph, src, dst, dx, dy, srcspan, dstspan);
+	return graph_copy(graph, src, dst, dx, dy, srcspan, dstspan, GRAPH_QUEUE_HIGH);
+}
+
+
+static int test_print(graph_t *graph, const graph_font_t *font, const char *text, unsigned int x, unsigned int y, unsigned char dx, unsigned char dy, unsigned int color)
+{
+	test_damage(x, y, strlen(text) * (font->width * dx / font->height), dy);
+
+	if (test_graph_common.mem)
+		return memfb_print(graph, font, text, x, y, dx, dy, color);
+	return graph_print(graph, font, text, x, y, dx, dy, color, GRAPH_QUEUE_HIGH);
+}
+
+
+static int test_colorset(graph_t *graph, const unsigned char *colors, unsigned char first, unsigned char last)
+{
+	if (test_graph_common.mem)
+		return memfb_colorset(graph, colors, first, last);
+	return graph_colorset(graph, colors, first, last);
+}
+
+
+static int test_colorget(graph_t *graph, unsigned char *colors, unsigned char first, unsigned char last)
+{
+	if (test_graph_common.mem)
+		return memfb_colorget(graph, colors, first, last);
+	return graph_colorget(graph, colors, first, last);
+}
+
+
+static int test_cursorset(graph_t *graph, const unsigned char *amask, const unsigned char *xmask, unsigned int bg, unsigned int fg)
+{
+	if (test_graph_common.mem) {
+		test_damage(test_graph_common.cx, test_graph_common.cy, MEMFB_CURSORSZ, MEMFB_CURSORSZ);
+		return memfb_cursorset(graph, amask, xmask, bg, fg);
+	}
+	return graph_cursorset(graph, amask, xmask, bg, fg);
+}
+
+
+/* Software cursor is drawn into memory framebuffer, damaging old and new position */
+static int test_cursorpos(graph_t *graph, unsigned int x, unsigned int y)
+{
+	if (test_graph_common.mem) {
+		test_damage(test_graph_common.cx, test_graph_common.cy, MEMFB_CURSORSZ, MEMFB_CURSORSZ);
+		test_damage(x, y, MEMFB_CURSORSZ, MEMFB_CURSORSZ);
+	}
+	test_graph_common.cx = x;
+	test_graph_common.cy = y;
+
+	if (test_graph_common.mem)
+		return memfb_cursorpos(graph, x, y);
+	return graph_cursorpos(graph, x, y);
+}
+
+
+static int test_cursorshow(graph_t *graph)
+{
+	if (test_graph_common.mem) {
+		test_damage(test_graph_common.cx, test_graph_common.cy, MEMFB_CURSORSZ, MEMFB_CURSORSZ);
+		return memfb_cursorshow(graph);
+	}
+	return graph_cursorshow(graph);
+}
+
+
+static int test_cursorhide(graph_t *graph)
+{
+	if (test_graph_common.mem) {
+		test_damage(test_graph_common.cx, test_graph_common.cy, MEMFB_CURSORSZ, MEMFB_CURSORSZ);
+		return memfb_cursorhide(graph);
+	}
+	return graph_cursorhide(graph);
+}
 
 
 /* Forces all scheduled tasks completion */
 static int test_trigger(graph_t *graph)
 {
+	if (test_graph_common.mem)
+		return EOK;
+
 	while (graph_trigger(graph))
 		;
 	return graph_commit(graph);
@@ -39,14 +242,89 @@ static int test_trigger(graph_t *graph)
 /* Forces next scheduled task to run immediately after vsync */
 static int test_vtrigger(graph_t *graph)
 {
+	unsigned int tasks = 0, n = test_graph_common.pacing.n;
+	uint64_t t;
+	int vsyncs, err;
+
+	if (test_graph_common.mem)
+		return EOK;
+
 	while (graph_trigger(graph))
+		tasks++;
+	while (!(vsyncs = graph_vsync(graph)))
 		;
-	while (!graph_vsync(graph))
-		;
-	return graph_commit(graph);
+
+	t = bench_time();
+	err = graph_commit(graph);
+
+	/* graph_vsync() returns number of vsyncs since previous call, more than one means missed frames */
+	if (n < PACING_MAXFRAMES) {
+		test_graph_common.pacing.frame[n] = (test_graph_common.pacing.last != 0) ? t - test_graph_common.pacing.last : 0;
+		test_graph_common.pacing.commit[n] = bench_time() - t;
+		test_graph_common.pacing.n++;
+	}
+	test_graph_common.pacing.last = t;
+	test_graph_common.pacing.frames++;
+	test_graph_common.pacing.missed += vsyncs - 1;
+	test_graph_common.pacing.tasks += tasks;
+	if (tasks > test_graph_common.pacing.maxtasks)
+		test_graph_common.pacing.maxtasks = tasks;
+
+	return err;
+}
+
+
+/* Prints frame pacing statistics of test phase and starts next one */
+static void test_pacing(const char *phase)
+{
+	char name[64];
+	unsigned int n = test_graph_common.pacing.n;
+
+	if (n > 1) {
+		/* First frame has no previous vsync to measure from */
+		snprintf(name, sizeof(name), "test_graph/%s frame", phase);
+		bench_print(name, test_graph_common.pacing.frame + 1, n - 1);
+		snprintf(name, sizeof(name), "test_graph/%s commit", phase);
+		bench_print(name, test_graph_common.pacing.commit, n);
+		printf("test_graph/%s: %u frames (%u recorded), %u missed vsyncs, queue depth avg %u max %u\n",
+			phase, test_graph_common.pacing.frames, n, test_graph_common.pacing.missed,
+			test_graph_common.pacing.tasks / test_graph_common.pacing.frames, test_graph_common.pacing.maxtasks);
+	}
+
+	memset(&test_graph_common.pacing, 0, sizeof(test_graph_common.pacing));
+}
+
+
+/* Prints memory framebuffer checksum and compares it against expected one */
+static int test_checksum(graph_t *graph, const char *name)
+{
+	uint32_t sum, expected;
+	unsigned int i;
+
+	if (!test_graph_common.mem)
+		return EOK;
+
+	for (i = 0; i < sizeof(test_sums) / sizeof(test_sums[0]); i++) {
+		if (strcmp(test_sums[i].name, name) == 0)
+			break;
+	}
+
+	if (i == sizeof(test_sums) / sizeof(test_sums[0]))
+		return -EINVAL;
+
+	sum = memfb_checksum(graph);
+	expected = test_sums[i].sum[graph->depth >> 1];
+	if (sum != expected) {
+		printf("test_graph: %s checksum %08x, expected %08x\n", name, sum, expected);
+		return -EFAULT;
+	}
+	printf("test_graph: %s checksum %08x\n", name, sum);
+
+	return EOK;
 }
 
 
+
 int test_lines1(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 {
 	unsigned int i;
@@ -56,7 +334,7 @@ int test_lines1(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 	for (i = 0; i < 500; i++) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_line(graph, rand() % (graph->width - dx - 2 * step) + step, rand() % (graph->height - dx - 2 * step) + step, rand() % dx, rand() % dy, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_line(graph, test_rand() % (graph->width - dx - 2 * step) + step, test_rand() % (graph->height - dx - 2 * step) + step, test_rand() % dx, test_rand() % dy, 1, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
@@ -64,15 +342,18 @@ int test_lines1(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 	for (i = 0; i < 100000; i++) {
 		if ((err = test_trigger(graph)) < 0)
 			return err;
-		if ((err = graph_line(graph, rand() % (graph->width - 2 * dx - 2 * step) + step + dx, rand() % (graph->height - 2 * dy - 2 * step) + step + dy, rand() % (2 * dx) - dx, rand() % (2 * dy) - dy, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_line(graph, test_rand() % (graph->width - 2 * dx - 2 * step) + step + dx, test_rand() % (graph->height - 2 * dy - 2 * step) + step + dy, test_rand() % (2 * dx) - dx, test_rand() % (2 * dy) - dy, 1, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
+	if ((err = test_checksum(graph, "lines1")) < 0)
+		return err;
+
 	/* Move up */
 	for (i = 0; i < graph->height; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, 0, step, graph->width, graph->height - step, 0, -step, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, 0, step, graph->width, graph->height - step, 0, -step)) < 0)
 			return err;
 	}
 
@@ -86,29 +367,32 @@ int test_lines2(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 	int err;
 
 	/* Background rectangle */
-	if ((err = graph_rect(graph, dx, dy, graph->width - 2 * dx + 1, graph->height - 2 * dy + 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+	if ((err = test_rect(graph, dx, dy, graph->width - 2 * dx + 1, graph->height - 2 * dy + 1, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 		return err;
 
 	/* Slow lines */
 	for (i = 0; i < graph->height - 2 * dy; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_line(graph, dx, dy + i, graph->width - 2 * dx, graph->height - 2 * dy - i * step, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_line(graph, dx, dy + i, graph->width - 2 * dx, graph->height - 2 * dy - i * step, 1, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
 	for (i = 0; i < graph->width - 2 * dy; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_line(graph, dx + i, graph->height - dy, graph->width - 2 * dx - i * step, 2 * dy - graph->height, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_line(graph, dx + i, graph->height - dy, graph->width - 2 * dx - i * step, 2 * dy - graph->height, 1, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
+	if ((err = test_checksum(graph, "lines2")) < 0)
+		return err;
+
 	/* Move up */
 	for (i = 0; i < graph->height; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, 0, step, graph->width, graph->height - step, 0, -step, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, 0, step, graph->width, graph->height - step, 0, -step)) < 0)
 			return err;
 	}
 
@@ -125,7 +409,7 @@ int test_rectangles(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 	for (i = 0; i < 300; i++) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_rect(graph, rand() % (graph->width - dx - 2 * step) + step, rand() % (graph->height - dy - 2 * step) + step, dx, dy, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_rect(graph, test_rand() % (graph->width - dx - 2 * step) + step, test_rand() % (graph->height - dy - 2 * step) + step, dx, dy, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
@@ -133,15 +417,18 @@ int test_rectangles(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 	for (i = 0; i < 10000; i++) {
 		if ((err = test_trigger(graph)) < 0)
 			return err;
-		if ((err = graph_rect(graph, rand() % (graph->width - dx - 2 * step) + step, rand() % (graph->height - dy - 2 * step) + step, dx, dy, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_rect(graph, test_rand() % (graph->width - dx - 2 * step) + step, test_rand() % (graph->height - dy - 2 * step) + step, dx, dy, test_rand() % (1ULL << 8 * graph->depth))) < 0)
 			return err;
 	}
 
+	if ((err = test_checksum(graph, "rectangles")) < 0)
+		return err;
+
 	/* Move right */
 	for (i = 0; i < graph->width; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, 0, 0, graph->width - step, graph->height, step, 0, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, 0, 0, graph->width - step, graph->height, step, 0)) < 0)
 			return err;
 	}
 
@@ -149,61 +436,74 @@ int test_rectangles(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 }
 
 
+/* Returns run-length encoded logo for color depth or NULL if there's none */
+static const unsigned char *test_logoget(unsigned char depth, size_t *size)
+{
+	switch (depth) {
+		case 1:
+			*size = sizeof(logo8_rle);
+			return logo8_rle;
+
+		case 2:
+			*size = sizeof(logo16_rle);
+			return logo16_rle;
+
+		case 4:
+			*size = sizeof(logo32_rle);
+			return logo32_rle;
+
+		default:
+			return NULL;
+	}
+}
+
+
 int test_logo(graph_t *graph, int step)
 {
 	static const char text[] = "Phoenix-RTOS";                      /* Text under logo */
 	static const unsigned int fx = (sizeof(text) - 1) * font.width; /* Text width */
 	static const unsigned int fy = font.height;                     /* Text height */
-	static const unsigned int lx = 200;                             /* Logo width */
-	static const unsigned int ly = 150;                             /* Logo height */
+	static const unsigned int lx = LOGO_WIDTH;                      /* Logo width */
+	static const unsigned int ly = LOGO_HEIGHT;                     /* Logo height */
 	static const unsigned int dy = ly + (6 * fy) / 5;               /* Total height */
 	const unsigned char *logo;
 	unsigned char buff[2][3];
 	unsigned int i, x, y, bg, fg;
 	int err, sy, ay;
+	size_t size;
 
-	switch (graph->depth) {
-		case 1:
-			logo = logo8[0];
-			bg = *(uint8_t *)logo;
-			fg = 1;
-			graph_colorget(graph, buff[0], 0, 1);
-			graph_colorset(graph, cmap[0], 0, 1);
-			break;
-
-		case 2:
-			logo = logo16[0];
-			bg = *(uint16_t *)logo;
-			fg = 0xffff;
-			break;
-
-		case 4:
-			logo = logo32[0];
-			bg = *(uint32_t *)logo;
-			fg = 0xffffffff;
-			break;
+	if ((logo = test_logoget(graph->depth, &size)) == NULL) {
+		printf("test_graph: logo test not supported for selected graphics mode. Skipping...\n");
+		return EOK;
+	}
+	bg = rle_pixel(logo, graph->depth);
+	fg = (1ULL << 8 * graph->depth) - 1;
 
-		default:
-			printf("test_graph: logo test not supported for selected graphics mode. Skipping...\n");
-			return EOK;
+	if (graph->depth == 1) {
+		fg = 1;
+		test_colorget(graph, buff[0], 0, 1);
+		test_colorset(graph, cmap[0], 0, 1);
 	}
 
 	x = graph->width - lx - 2 * step;
 	y = graph->height - dy - 2 * step;
 
 	/* Compose logo at bottom left corner */
-	if ((err = graph_rect(graph, 0, 0, graph->width, graph->height, bg, GRAPH_QUEUE_HIGH)) < 0)
+	if ((err = test_rect(graph, 0, 0, graph->width, graph->height, bg)) < 0)
 		return err;
-	if ((err = graph_copy(graph, logo, (void *)((uintptr_t)graph->data + graph->depth * ((graph->height - dy) * graph->width + step)), lx, ly, graph->depth * lx, graph->depth * graph->width, GRAPH_QUEUE_HIGH)) < 0)
+	/* Logo is decoded straight into framebuffer, so background has to be drawn first */
+	if ((err = test_trigger(graph)) < 0)
 		return err;
-	if ((err = graph_print(graph, &font, text, step + (lx - fx) / 2 + 1, graph->height - fy, font.height, font.height, fg, GRAPH_QUEUE_HIGH)) < 0)
+	if ((err = rle_decode(logo, size, (void *)((uintptr_t)graph->data + graph->depth * ((graph->height - dy) * graph->width + step)), lx, ly, graph->depth * graph->width, graph->depth)) < 0)
+		return err;
+	if ((err = test_print(graph, &font, text, step + (lx - fx) / 2 + 1, graph->height - fy, font.height, font.height, fg)) < 0)
 		return err;
 
 	/* Move right */
 	for (i = 0; i < x; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, 0, graph->height - dy - step, graph->width - step, dy, step, 0, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, 0, graph->height - dy - step, graph->width - step, dy, step, 0)) < 0)
 			return err;
 	}
 
@@ -213,7 +513,7 @@ int test_logo(graph_t *graph, int step)
 		sy = (ay < sy) ? sy - ay : 0;
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, step, step, graph->width - step, graph->height - step, -step, -sy, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, step, step, graph->width - step, graph->height - step, -step, -sy)) < 0)
 			return err;
 	}
 
@@ -221,7 +521,7 @@ int test_logo(graph_t *graph, int step)
 	for (i = 0; i < x; i += step) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, 0, 0, graph->width - step, dy, step, 0, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, 0, 0, graph->width - step, dy, step, 0)) < 0)
 			return err;
 	}
 
@@ -231,13 +531,16 @@ int test_logo(graph_t *graph, int step)
 		sy = (ay < sy) ? sy - ay : 0;
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_move(graph, step, 0, graph->width - step, graph->height - step, -step, sy, GRAPH_QUEUE_HIGH)) < 0)
+		if ((err = test_move(graph, step, 0, graph->width - step, graph->height - step, -step, sy)) < 0)
 			return err;
 	}
 
+	if ((err = test_checksum(graph, "logo")) < 0)
+		return err;
+
 	/* Restore color map */
 	if (graph->depth == 1)
-		graph_colorset(graph, buff[0], 0, 1);
+		test_colorset(graph, buff[0], 0, 1);
 
 	return EOK;
 }
@@ -245,43 +548,588 @@ int test_logo(graph_t *graph, int step)
 
 int test_cursor(graph_t *graph)
 {
+	static const unsigned char bw[2][3] = { { 0x00, 0x00, 0x00 }, { 0xff, 0xff, 0xff } };
+	unsigned char buff[2][3];
 	unsigned int i;
 	int err;
 
-	if ((err = graph_cursorset(graph, amask[0], xmask[0], 0xff000000, 0xffffffff)) < 0) {
+	/* Cursor colors map to color map entries, so they have to differ for the cursor to be visible */
+	if (graph->depth == 1) {
+		test_colorget(graph, buff[0], 0, 1);
+		test_colorset(graph, bw[0], 0, 1);
+	}
+
+	if ((err = test_cursorset(graph, amask[0], xmask[0], 0xff000000, 0xffffffff)) < 0) {
 		if (err != -ENOTSUP)
 			return err;
 		printf("test_graph: hardware cursor not supported. Skipping...\n");
+		if (graph->depth == 1)
+			test_colorset(graph, buff[0], 0, 1);
 		return EOK;
 	}
 
-	if ((err = graph_cursorshow(graph)) < 0)
+	if ((err = test_cursorshow(graph)) < 0)
 		return err;
 
 	for (i = 0; i < graph->height; i++) {
 		if ((err = test_vtrigger(graph)) < 0)
 			return err;
-		if ((err = graph_cursorpos(graph, i * graph->width / graph->height, i)) < 0)
+		if ((err = test_cursorpos(graph, i * graph->width / graph->height, i)) < 0)
 			return err;
 	}
 
-	if ((err = graph_cursorhide(graph)) < 0)
+	/* The last position leaves only the cursor's corner on screen, move it back in before checking */
+	if ((err = test_cursorpos(graph, graph->width / 2, graph->height / 2)) < 0)
 		return err;
 
+	if ((err = test_checksum(graph, "cursor")) < 0)
+		return err;
+
+	if ((err = test_cursorhide(graph)) < 0)
+		return err;
+
+	/* Restore color map */
+	if (graph->depth == 1)
+		test_colorset(graph, buff[0], 0, 1);
+
 	return EOK;
 }
 
 
+/* Renders 'A' 1:1 on memory framebuffer and compares it pixel by pixel against known bitmap */
+static int test_glyph(void)
+{
+	static const char *glyph[] = {
+		"................",
+		"................",
+		"................",
+		"................",
+		"........##......",
+		"........##......",
+		"......######....",
+		"......######....",
+		"....####..####..",
+		"....####..####..",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..##############",
+		"..##############",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"..####......####",
+		"................",
+		"................",
+		"................",
+		"................",
+		"................",
+		"................",
+		"................",
+		"................",
+	};
+	static const char *names[] = { "memfb_print", "glyph_print" };
+	const unsigned char *p;
+	unsigned int r, x, y;
+	glyph_cache_t cache;
+	graph_t graph;
+	int err;
+
+	if ((err = memfb_open(&graph, font.width, font.height, 1)) < 0)
+		return err;
+
+	for (r = 0; (r < sizeof(names) / sizeof(names[0])) && (err >= 0); r++) {
+		memfb_rect(&graph, 0, 0, graph.width, graph.height, 0);
+
+		if (r == 0) {
+			err = memfb_print(&graph, &font, "A", 0, 0, font.height, font.height, 0xff);
+		}
+		else if ((err = glyph_cacheinit(&cache, &font, font.height, font.height)) >= 0) {
+			err = glyph_print(&graph, &cache, "A", 0, 0, 0xff);
+			glyph_cachedone(&cache);
+		}
+
+		p = graph.data;
+		for (y = 0; (y < font.height) && (err >= 0); y++) {
+			for (x = 0; x < font.width; x++) {
+				if ((p[y * font.width + x] != 0) != (glyph[y][x] == '#')) {
+					printf("test_graph: %s glyph 'A' pixel mismatch at %u,%u, expected row %s\n", names[r], x, y, glyph[y]);
+					err = -EFAULT;
+					break;
+				}
+			}
+		}
+	}
+	memfb_close(&graph);
+
+	return err;
+}
+
+
+/* Checks text drawn 1:1 at top left corner pixel by pixel against font bitmap */
+static int test_textcheck(graph_t *graph, const char *name, const char *text)
+{
+	const unsigned char *bits, *p;
+	unsigned int i, x, y, k, set;
+
+	for (i = 0; text[i] != '\0'; i++) {
+		bits = font.data + (unsigned char)(text[i] - font.offs) * font.span * font.height;
+
+		for (y = 0; y < font.height; y++) {
+			for (x = 0; x < font.width; x++) {
+				p = (unsigned char *)graph->data + (y * graph->width + i * font.width + x) * graph->depth;
+				for (k = 0, set = 0; k < graph->depth; k++)
+					set |= p[k];
+
+				if ((set != 0) != ((bits[y * font.span + x / 8] >> (x % 8)) & 1)) {
+					printf("test_graph: %s output differs from font bitmap at char %u pixel %u,%u\n", name, i, x, y);
+					return -EIO;
+				}
+			}
+		}
+	}
+
+	return EOK;
+}
+
+
+/* Returns number of pixels drawn by benchmark operation */
+static unsigned int test_bench_pixels(int prim, unsigned int size)
+{
+	switch (prim) {
+		case prim_line:
+			return size;
+
+		case prim_print:
+			return (size / 8) * font.width * font.height;
+
+		default:
+			return size * size;
+	}
+}
+
+
+/* Issues i-th benchmark operation */
+static int test_bench_op(graph_t *graph, int prim, unsigned int size, unsigned int i, const void *src)
+{
+	static const char text[] = "Phoenix-RTOS Phoenix-RTOS Phoenix-RTOS Phoenix-RTOS Phoenix-RTOS";
+	unsigned int x, y, color = i * 0x01010101;
+
+	/* Spread operations over the screen, leaving room for move */
+	x = (i * 37) % (graph->width - size - 2);
+	y = (i * 23) % (graph->height - size - 2);
+
+	switch (prim) {
+		case prim_rect:
+			return test_rect(graph, x, y, size, size, color);
+
+		case prim_line:
+			return test_line(graph, x, y, size - 1, size - 1, 1, color);
+
+		case prim_move:
+			return test_move(graph, x, y, size, size, 2, 2);
+
+		case prim_copy:
+			return test_copy(graph, src, (void *)((uintptr_t)graph->data + graph->depth * (y * graph->width + x)), size, size, graph->depth * size, graph->depth * graph->width);
+
+		case prim_print:
+			return test_print(graph, &font, text + sizeof(text) - 1 - size / 8, 0, (i * 23) % (graph->height - font.height), font.height, font.height, color);
+	}
+
+	return -EINVAL;
+}
+
+
+/* Times all primitives over bench_sizes, splitting queue submission from execution for libgraph */
+static int test_bench_run(graph_t *graph, int mem, const void *src)
+{
+	uint64_t submit, raster, t;
+	unsigned int i, j, n, size;
+	int prim, err;
+
+	test_graph_common.mem = mem;
+
+	for (prim = 0; prim < prim_count; prim++) {
+		for (j = 0; j < sizeof(bench_sizes) / sizeof(bench_sizes[0]); j++) {
+			size = bench_sizes[j];
+			if ((size + 2 >= graph->width) || (size + 2 >= graph->height) || ((prim == prim_print) && (size / 8) * font.width > graph->width))
+				continue;
+
+			n = BENCH_PIXELS / test_bench_pixels(prim, size);
+			n = (n < BENCH_MINOPS) ? BENCH_MINOPS : (n > BENCH_MAXOPS) ? BENCH_MAXOPS : n;
+			submit = 0;
+			raster = 0;
+
+			for (i = 0; i < n; i++) {
+				t = bench_time();
+				if ((err = test_bench_op(graph, prim, size, i, src)) < 0)
+					return err;
+				submit += bench_time() - t;
+
+				if (!mem) {
+					t = bench_time();
+					if ((err = test_trigger(graph)) < 0)
+						return err;
+					raster += bench_time() - t;
+				}
+			}
+
+			/* Memory framebuffer draws synchronously, submission is rasterization */
+			if (mem) {
+				raster = submit;
+				submit = 0;
+			}
+
+			t = (submit + raster) ? submit + raster : 1;
+			printf("test_graph/bench %ux%ux%u %s %u: %u ops, %" PRIu64 " ops/s, %" PRIu64 " Kpix/s (submit %" PRIu64 " ns/op, raster %" PRIu64 " ns/op)\n",
+				graph->width, graph->height, graph->depth << 3, prim_names[prim], size, n, (uint64_t)n * 1000000 / t,
+				(uint64_t)n * test_bench_pixels(prim, size) * 1000 / t, submit * 1000 / n, raster * 1000 / n);
+		}
+	}
+
+	return EOK;
+}
+
+
+/* Times logo decoding straight into memory framebuffer */
+static int test_bench_logo(graph_t *graph)
+{
+	const unsigned char *logo;
+	unsigned int i, n;
+	uint64_t t;
+	size_t size;
+	int err;
+
+	if ((logo = test_logoget(graph->depth, &size)) == NULL)
+		return EOK;
+
+	n = BENCH_PIXELS / (LOGO_WIDTH * LOGO_HEIGHT);
+	n = (n < BENCH_MINOPS) ? BENCH_MINOPS : n;
+
+	t = bench_time();
+	for (i = 0; i < n; i++) {
+		if ((err = rle_decode(logo, size, (void *)((uintptr_t)graph->data + graph->depth * ((i * 23) % (graph->height - LOGO_HEIGHT) * graph->width + (i * 37) % (graph->width - LOGO_WIDTH))),
+				LOGO_WIDTH, LOGO_HEIGHT, graph->depth * graph->width, graph->depth)) < 0)
+			return err;
+	}
+	t = bench_time() - t;
+	t = t ? t : 1;
+
+	printf("test_graph/bench %ux%ux%u logo: %zu of %u bytes encoded, %u decodes, %" PRIu64 " us/decode, %" PRIu64 " MB/s\n",
+		graph->width, graph->height, graph->depth << 3, size, LOGO_WIDTH * LOGO_HEIGHT * graph->depth, n, t / n,
+		(uint64_t)n * LOGO_WIDTH * LOGO_HEIGHT * graph->depth / t);
+
+	return EOK;
+}
+
+
+/* Compares glyph-by-glyph memfb_print with cached batched glyph_print, checking they draw the same */
+static int test_bench_text(graph_t *graph)
+{
+	static const unsigned int lens[] = { 8, 32, 64 };
+	uint64_t tprint, tcache, tcold;
+	glyph_cache_t cache;
+	char text[65];
+	unsigned int i, j, n, len;
+	int err;
+
+	for (i = 0; i < sizeof(text) - 1; i++)
+		text[i] = '!' + (i * 7) % ('~' - '!' + 1);
+	text[i] = '\0';
+
+	for (j = 0; j < sizeof(lens) / sizeof(lens[0]); j++) {
+		len = lens[j];
+		if (len * font.width > graph->width)
+			continue;
+		n = BENCH_PIXELS / (font.width * font.height * len);
+		n = (n < BENCH_MINOPS) ? BENCH_MINOPS : n;
+
+		memfb_rect(graph, 0, 0, graph->width, graph->height, 0);
+		memfb_print(graph, &font, text + sizeof(text) - 1 - len, 0, 0, font.height, font.height, 0x12345678);
+		if ((err = test_textcheck(graph, "memfb_print", text + sizeof(text) - 1 - len)) < 0)
+			return err;
+
+		/* Cold cache expands every glyph on first use */
+		memfb_rect(graph, 0, 0, graph->width, graph->height, 0);
+		tcold = bench_time();
+		if ((err = glyph_cacheinit(&cache, &font, font.height, font.height)) < 0)
+			return err;
+		err = glyph_print(graph, &cache, text + sizeof(text) - 1 - len, 0, 0, 0x12345678);
+		tcold = bench_time() - tcold;
+
+		if (err >= 0)
+			err = test_textcheck(graph, "glyph_print", text + sizeof(text) - 1 - len);
+
+		if (err < 0) {
+			glyph_cachedone(&cache);
+			return err;
+		}
+
+		tprint = bench_time();
+		for (i = 0; i < n; i++)
+			memfb_print(graph, &font, text + sizeof(text) - 1 - len, 0, (i * 23) % (graph->height - font.height), font.height, font.height, i);
+		tprint = bench_time() - tprint;
+
+		tcache = bench_time();
+		for (i = 0; i < n; i++)
+			glyph_print(graph, &cache, text + sizeof(text) - 1 - len, 0, (i * 23) % (graph->height - font.height), i);
+		tcache = bench_time() - tcache;
+
+		tprint = tprint ? tprint : 1;
+		tcache = tcache ? tcache : 1;
+		printf("test_graph/bench %ux%ux%u text %u: print %" PRIu64 " chars/s, glyph cache %" PRIu64 " chars/s, speedup %" PRIu64 ".%02" PRIu64 "x (cold %" PRIu64 " us, %u glyphs)\n",
+			graph->width, graph->height, graph->depth << 3, len, (uint64_t)n * len * 1000000 / tprint, (uint64_t)n * len * 1000000 / tcache,
+			tprint / tcache, tprint * 100 / tcache % 100, tcold, cache.misses);
+
+		glyph_cachedone(&cache);
+	}
+
+	return EOK;
+}
+
+
+/* Draws i-th frame of UI-like workload: widgets, lines, label, scrolled list and cursor */
+static int test_bench_frame(graph_t *graph, unsigned int i)
+{
+	static const char text[] = "Phoenix-RTOS 00";
+	unsigned int j, x, y;
+	int err;
+
+	for (j = 0; j < 6; j++) {
+		x = ((i * 6 + j) * 97) % (graph->width - 48);
+		y = ((i * 6 + j) * 61) % (graph->height - 24);
+		if ((err = test_rect(graph, x, y, 48, 24, (i + j) * 0x01030507)) < 0)
+			return err;
+	}
+
+	for (j = 0; j < 2; j++) {
+		x = ((i * 2 + j) * 53) % (graph->width - 100);
+		y = ((i * 2 + j) * 41) % (graph->height - 100);
+		if ((err = test_line(graph, x, y, 99, (j & 1) ? 40 : -40, 1, i * 0x00010101)) < 0)
+			return err;
+	}
+
+	if ((err = test_print(graph, &font, text, graph->width - sizeof(text) * font.width, 0, font.height, font.height, i * 0x01010101)) < 0)
+		return err;
+
+	if ((err = test_move(graph, 64, 66, 256, 128, 0, -2)) < 0)
+		return err;
+
+	return test_cursorpos(graph, (i * 7) % (graph->width - MEMFB_CURSORSZ), (i * 5) % (graph->height - MEMFB_CURSORSZ));
+}
+
+
+/* Compares committing whole memory framebuffer with committing only damaged rectangles to scanout copy */
+static int test_bench_damage(graph_t *graph)
+{
+	size_t size = (size_t)graph->width * graph->height * graph->depth, full = 0, partial = 0;
+	uint64_t tfull, tdamage, t;
+	unsigned int i, rects = 0;
+	unsigned char *scanout;
+	damage_t damage;
+	int err = EOK;
+
+	if ((scanout = malloc(size)) == NULL)
+		return -ENOMEM;
+
+	damage_init(&damage, graph->width, graph->height);
+	test_cursorset(graph, amask[0], xmask[0], 0xff000000, 0xffffffff);
+	test_cursorshow(graph);
+
+	t = bench_time();
+	for (i = 0; (i < BENCH_FRAMES) && (err >= 0); i++) {
+		if ((err = test_bench_frame(graph, i)) >= 0) {
+			memcpy(scanout, graph->data, size);
+			full += size;
+		}
+	}
+	tfull = bench_time() - t;
+
+	test_graph_common.damage = &damage;
+	t = bench_time();
+	for (i = 0; (i < BENCH_FRAMES) && (err >= 0); i++) {
+		damage_clear(&damage);
+		if ((err = test_bench_frame(graph, BENCH_FRAMES + i)) >= 0) {
+			rects += damage.n;
+			partial += damage_commit(&damage, graph, scanout);
+		}
+	}
+	tdamage = bench_time() - t;
+	test_graph_common.damage = NULL;
+
+	/* Anything drawn but not tracked leaves scanout stale */
+	if ((err >= 0) && (memcmp(scanout, graph->data, size) != 0)) {
+		printf("test_graph: damaged rectangles don't cover all changes\n");
+		err = -EIO;
+	}
+
+	test_cursorhide(graph);
+	free(scanout);
+
+	if (err < 0)
+		return err;
+
+	printf("test_graph/bench %ux%ux%u damage: full %zu KB/frame %" PRIu64 " us/frame, damaged %zu KB/frame %" PRIu64 " us/frame, %u.%02u rects/frame\n",
+		graph->width, graph->height, graph->depth << 3, full / BENCH_FRAMES / 1024, tfull / BENCH_FRAMES,
+		partial / BENCH_FRAMES / 1024, tdamage / BENCH_FRAMES, rects / BENCH_FRAMES, rects * 100 / BENCH_FRAMES % 100);
+
+	return EOK;
+}
+
+
+/* Times cursor shape uploads and moves, hardware through libgraph or software drawn into framebuffer */
+static int test_bench_cursorrun(graph_t *graph, int sw, uint64_t *samples)
+{
+	unsigned char xinv[sizeof(xmask)];
+	const char *type = sw ? "sw" : "hw";
+	char name[64];
+	uint64_t t, total;
+	unsigned int i;
+	int err = EOK;
+
+	/* Alternate shapes and colors, so nothing can be skipped as unchanged (cursorset reads whole mask) */
+	for (i = 0; i < sizeof(xinv); i++)
+		xinv[i] = ~((const unsigned char *)xmask)[i];
+
+	total = bench_time();
+	for (i = 0; (i < BENCH_CURSORSET) && (err >= 0); i++) {
+		t = bench_time();
+		if (sw)
+			err = memfb_cursorset(graph, amask[0], (i & 1) ? xinv : xmask[0], 0xff000000 | i, 0xffffffff - i);
+		else
+			err = graph_cursorset(graph, amask[0], (i & 1) ? xinv : xmask[0], 0xff000000 | i, 0xffffffff - i);
+		samples[i] = bench_time() - t;
+	}
+	total = bench_time() - total;
+
+	if (err < 0) {
+		if (err != -ENOTSUP)
+			return err;
+		printf("test_graph/bench %ux%ux%u: hardware cursor not supported\n", graph->width, graph->height, graph->depth << 3);
+		return EOK;
+	}
+
+	snprintf(name, sizeof(name), "test_graph/bench %ux%ux%u %s cursorset", graph->width, graph->height, graph->depth << 3, type);
+	bench_print(name, samples, BENCH_CURSORSET);
+	printf("%s: %" PRIu64 " ns/op\n", name, total * 1000 / BENCH_CURSORSET);
+
+	if ((err = sw ? memfb_cursorshow(graph) : graph_cursorshow(graph)) < 0)
+		return err;
+
+	/* Software cursor on adapter is visible only after commit, so it's part of move latency */
+	total = bench_time();
+	for (i = 0; (i < BENCH_CURSORPOS) && (err >= 0); i++) {
+		t = bench_time();
+		if (sw) {
+			if (((err = memfb_cursorpos(graph, (i * 7) % graph->width, (i * 5) % graph->height)) >= 0) && !test_graph_common.mem)
+				err = graph_commit(graph);
+		}
+		else {
+			err = graph_cursorpos(graph, (i * 7) % graph->width, (i * 5) % graph->height);
+		}
+		samples[i] = bench_time() - t;
+	}
+	total = bench_time() - total;
+
+	if (err >= 0) {
+		snprintf(name, sizeof(name), "test_graph/bench %ux%ux%u %s cursorpos", graph->width, graph->height, graph->depth << 3, type);
+		bench_print(name, samples, BENCH_CURSORPOS);
+		printf("%s: %" PRIu64 " ns/op\n", name, total * 1000 / BENCH_CURSORPOS);
+	}
+
+	if (sw)
+		memfb_cursorhide(graph);
+	else
+		graph_cursorhide(graph);
+
+	return err;
+}
+
+
+/* Compares hardware cursor (adapter only) with software cursor fallback */
+static int test_bench_cursor(graph_t *graph)
+{
+	uint64_t *samples;
+	int err;
+
+	if ((samples = malloc(BENCH_CURSORPOS * sizeof(*samples))) == NULL)
+		return -ENOMEM;
+
+	if (test_graph_common.mem || ((err = test_bench_cursorrun(graph, 0, samples)) >= 0))
+		err = test_bench_cursorrun(graph, 1, samples);
+
+	free(samples);
+
+	return err;
+}
+
+
+/* Benchmarks headless memory framebuffer at all depths, then graphics adapter if available */
+int test_bench(graph_adapter_t adapter, graph_mode_t mode, graph_freq_t freq)
+{
+	static const unsigned char depths[] = { 1, 2, 4 };
+	graph_t graph;
+	unsigned int i;
+	void *src;
+	int err;
+
+	if ((err = test_glyph()) < 0)
+		return err;
+
+	if ((src = calloc(BENCH_MAXSZ * BENCH_MAXSZ, 4)) == NULL)
+		return -ENOMEM;
+
+	for (i = 0; i < sizeof(depths); i++) {
+		if ((err = memfb_open(&graph, BENCH_WIDTH, BENCH_HEIGHT, depths[i])) < 0)
+			break;
+
+		if (((err = test_bench_run(&graph, 1, src)) >= 0) && ((err = test_bench_logo(&graph)) >= 0) &&
+			((err = test_bench_text(&graph)) >= 0) && ((err = test_bench_damage(&graph)) >= 0))
+			err = test_bench_cursor(&graph);
+		memfb_close(&graph);
+
+		if (err < 0)
+			break;
+	}
+
+	if ((err >= 0) && ((err = graph_init()) >= 0)) {
+		if (graph_open(&graph, adapter, 0x2000) < 0) {
+			printf("test_graph: no graphics adapter, skipping libgraph benchmark\n");
+		}
+		else {
+			if (((err = graph_mode(&graph, mode, freq)) >= 0) && ((err = test_bench_run(&graph, 0, src)) >= 0))
+				err = test_bench_cursor(&graph);
+
+			test_trigger(&graph);
+			graph_close(&graph);
+		}
+		graph_done();
+	}
+
+	free(src);
+
+	return err;
+}
+
+
 void test_help(const char *prog)
 {
-	printf("Usage: %s [adapter] [-m mode] [-f freq]\n", prog);
+	printf("Usage: %s [adapter] [-m mode] [-f freq] [-d depth] [-b]\n", prog);
 	printf("\tGraphics adapters:\n");
 	printf("\t--cirrus     - use Cirrus Logic GD5446 VGA graphics adapter\n");
 	printf("\t--virtio-gpu - use VirtIO GPU graphics adapter\n");
 	printf("\t--vga        - use generic VGA adapter\n");
+	printf("\t--mem        - use %ux%u memory framebuffer, verifies checksums\n", BENCH_WIDTH, BENCH_HEIGHT);
 	printf("\tOther arguments:\n");
 	printf("\t-m, --mode   - graphics mode index\n");
 	printf("\t-f, --freq   - screen refresh rate index\n");
+	printf("\t-d, --depth  - memory framebuffer color depth in bytes (1, 2 or 4)\n");
+	printf("\t-b, --bench  - benchmarks primitives on memory framebuffer and adapter\n");
 	printf("\t-h, --help   - prints this help message\n");
 }
 
@@ -295,15 +1143,18 @@ int main(int argc, char *argv[])
 		{ "cirrus", no_argument, &adapter, GRAPH_CIRRUS },
 		{ "virtio-gpu", no_argument, &adapter, GRAPH_VIRTIOGPU },
 		{ "vga", no_argument, &adapter, GRAPH_VGA },
+		{ "mem", no_argument, &test_graph_common.mem, 1 },
 		{ "mode", required_argument, NULL, 'm' },
 		{ "freq", required_argument, NULL, 'f' },
+		{ "depth", required_argument, NULL, 'd' },
+		{ "bench", no_argument, NULL, 'b' },
 		{ "help", no_argument, NULL, 'h' },
 		{ NULL, 0, NULL, 0 }
 	};
 	graph_t graph;
-	int ret, c;
+	int ret, c, bench = 0, depth = 4;
 
-	while ((c = getopt_long(argc, argv, "m:f:h", longopts, NULL)) != -1) {
+	while ((c = getopt_long(argc, argv, "m:f:d:bh", longopts, NULL)) != -1) {
 		switch (c) {
 			case 0:
 				/* Graphics adapter */
@@ -319,6 +1170,14 @@ int main(int argc, char *argv[])
 				freq = atoi(optarg) + 1;
 				break;
 
+			case 'd':
+				depth = atoi(optarg);
+				break;
+
+			case 'b':
+				bench = 1;
+				break;
+
 			case 'h':
 			case '?':
 			default:
@@ -327,25 +1186,39 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	if ((ret = graph_init()) < 0) {
-		fprintf(stderr, "test_graph: failed to initialize library\n");
+	if (bench) {
+		if ((ret = test_bench(adapter, mode, freq)) < 0)
+			fprintf(stderr, "test_graph: benchmark failed\n");
 		return ret;
 	}
 
-	if ((ret = graph_open(&graph, adapter, 0x2000)) < 0) {
-		fprintf(stderr, "test_graph: failed to initialize graphics adapter\n");
-		graph_done();
-		return ret;
+	if (test_graph_common.mem) {
+		if ((ret = memfb_open(&graph, BENCH_WIDTH, BENCH_HEIGHT, depth)) < 0) {
+			fprintf(stderr, "test_graph: failed to create memory framebuffer\n");
+			return ret;
+		}
+	}
+	else {
+		if ((ret = graph_init()) < 0) {
+			fprintf(stderr, "test_graph: failed to initialize library\n");
+			return ret;
+		}
+
+		if ((ret = graph_open(&graph, adapter, 0x2000)) < 0) {
+			fprintf(stderr, "test_graph: failed to initialize graphics adapter\n");
+			graph_done();
+			return ret;
+		}
 	}
 
 	do {
-		if ((ret = graph_mode(&graph, mode, freq)) < 0) {
+		if (!test_graph_common.mem && ((ret = graph_mode(&graph, mode, freq)) < 0)) {
 			fprintf(stderr, "test_graph: failed to set graphics mode\n");
 			break;
 		}
 		printf("test_graph: starting test in %ux%ux%u graphics mode\n", graph.width, graph.height, graph.depth << 3);
 
-		if ((ret = graph_rect(&graph, 0, 0, graph.width, graph.height, 0, GRAPH_QUEUE_HIGH)) < 0) {
+		if ((ret = test_rect(&graph, 0, 0, graph.width, graph.height, 0)) < 0) {
 			fprintf(stderr, "test_graph: failed to clear screen\n");
 			break;
 		}
@@ -355,35 +1228,45 @@ int main(int argc, char *argv[])
 			fprintf(stderr, "test_graph: lines1 test failed\n");
 			break;
 		}
+		test_pacing("lines1");
 
 		printf("test_graph: starting lines2 test...\n");
 		if ((ret = test_lines2(&graph, 64, 64, 2)) < 0) {
 			fprintf(stderr, "test_graph: lines2 test failed\n");
 			break;
 		}
+		test_pacing("lines2");
 
 		printf("test_graph: starting rectangles test...\n");
 		if ((ret = test_rectangles(&graph, 32, 32, 2)) < 0) {
 			fprintf(stderr, "test_graph: rectangles test failed\n");
 			break;
 		}
+		test_pacing("rectangles");
 
 		printf("test_graph: starting logo test...\n");
 		if ((ret = test_logo(&graph, 2)) < 0) {
 			fprintf(stderr, "test_graph: logo test failed\n");
 			break;
 		}
+		test_pacing("logo");
 
 		printf("test_graph: starting cursor test...\n");
 		if ((ret = test_cursor(&graph)) < 0) {
 			fprintf(stderr, "test_graph: cursor test failed\n");
 			break;
 		}
+		test_pacing("cursor");
 	} while (0);
 
 	test_trigger(&graph);
-	graph_close(&graph);
-	graph_done();
+	if (test_graph_common.mem) {
+		memfb_close(&graph);
+	}
+	else {
+		graph_close(&graph);
+		graph_done();
+	}
 
 	if (!ret)
 		printf("test_graph: test finished successfully\n");
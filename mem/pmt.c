@@ -1,110 +1,487 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <errno.h>
-#include <string.h>
-#include "/usr/include/errno.h"
-
-#if 1
-#define printf(x, ...)
-#define putchar(x)
-#endif
-
-/* #include "libphoenix.h" */
-
-
-int main(int argc, char *argv[]) {
-	int i, ops, count, size, max_size;
-	unsigned char **bufs;
-	
-	if (argc > 1)
-		count = strtol(argv[1], NULL, 0);
-	else
-		count = 33;
-
-	if (argc > 2)
-		max_size = strtol(argv[2], NULL, 0);
-	else
-		max_size = 65;
-
-	_malloc_init();
-	bufs = malloc(count * sizeof(char *));
-	if (!bufs) {
-		printf("Out of memory(%s).\n", strerror(errno));
-		exit(1);
-	}
-	for (i = 0, ops = 0; i < count; ++i, ++ops) {
-		size = 0x20 * i + 0x50;
-		if (size > max_size)
-			size = max_size;
-		     
-		bufs[i] = malloc(size);
-		memset(bufs[i], 0xff, size);
-		putchar('.');
-	}
-
-	printf("%d buffers allocated\n", ops);
-	
-	for (i = 16, ops = 0; i < count; ++i, ++ops) {
-		free(bufs[i]);
-		putchar(',');
-	}
-
-	printf("%d buffers freed\n", ops);
-
-	for (i = 16, ops = 0; i < count; ++i, ++ops) {
-		size = 0x20 * i + 0x50;
-		if (size > max_size)
-			size = max_size;
-		     
-		bufs[i] = calloc(size / 4, 2);
-		memset(bufs[i], 0xff, (size / 4) * 2);
-		putchar('.');
-	}
-
-	printf("%d buffers allocated\n", ops);
-	
-	for (i = 0, ops = 0; i < count; i += 2, ++ops) {
-		size = 0x20 * i + 0x90;
-		if (size > max_size)
-			size = max_size;
-		     
-		bufs[i] = realloc(bufs[i], size);
-		memset(bufs[i], 0xff, size);
-		putchar('.');
-	}
-
-	printf("%d buffers reallocated\n", ops);
-
-	for (i = 0, ops = 0; i < count / 2; ++i, ++ops) {
-		free(bufs[i]);
-		putchar(',');
-	}
-
-	printf("%d buffers freed\n", ops);
-
-	for (i = 0, ops = 0; i < count / 2; ++i, ++ops) {
-		size = 0x11 * i + 0x20;
-		if (size > max_size)
-			size = max_size;
-		     
-		bufs[i] = malloc(size);
-		memset(bufs[i], 0xff, size);
-		putchar('.');
-	}
-
-	printf("%d buffers allocated\n", ops);
-	
-	for (i = 0, ops = 0; i < count; ++i, ++ops) {
-		free(bufs[i]);
-#ifdef USE_AFTER_FREE
-		memset(bufs[i], 0xff, size);
-#endif
-		putchar(',');
-	}
-
-	printf("%d buffers freed\n", ops);
-
-	free(bufs);
-	
-	return 0;
-}
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/pmt - allocator trace replay tool
+ *
+ * Copyright 2017, 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+/* Slot ids index the slot table directly, so traces have to use dense ids */
+#define PMT_MAXSLOTS (1 << 20)
+
+
+/*
+ * Trace format (text, one event per line, '#' starts a comment):
+ *   m <id> <size>          - slot <id> = malloc(size)
+ *   c <id> <nmemb> <size>  - slot <id> = calloc(nmemb, size)
+ *   r <id> <size>          - slot <id> = realloc(slot <id>, size)
+ *   f <id>                 - free(slot <id>)
+ * Slot ids identify live allocations, traces captured from processes should map
+ * each returned address to a slot id which is reused after the block is freed.
+ */
+
+
+typedef struct {
+	char type;
+	unsigned int id;
+	size_t nmemb;
+	size_t size;
+} pmt_event_t;
+
+
+typedef struct {
+	void *ptr;
+	size_t size;
+} pmt_slot_t;
+
+
+static struct {
+	pmt_event_t *events;
+	size_t nevents;
+	size_t eventsz;
+
+	pmt_slot_t *slots;
+	unsigned int nslots;
+
+	int touch;
+	unsigned int interval;
+
+	/* Statistics */
+	unsigned int ops[4];
+	unsigned int failed;
+	size_t live;
+	size_t peak;
+	unsigned int blocks;
+	unsigned int peakblocks;
+	float frag;
+	float maxfrag;
+} pmt_common;
+
+
+static const char pmt_types[] = "mcrf";
+
+
+static int pmt_add(char type, unsigned int id, size_t nmemb, size_t size)
+{
+	pmt_event_t *events;
+
+	if (pmt_common.nevents == pmt_common.eventsz) {
+		pmt_common.eventsz = pmt_common.eventsz ? 2 * pmt_common.eventsz : 256;
+		if ((events = realloc(pmt_common.events, pmt_common.eventsz * sizeof(*events))) == NULL)
+			return -ENOMEM;
+		pmt_common.events = events;
+	}
+
+	events = &pmt_common.events[pmt_common.nevents++];
+	events->type = type;
+	events->id = id;
+	events->nmemb = nmemb;
+	events->size = size;
+
+	if (id >= pmt_common.nslots)
+		pmt_common.nslots = id + 1;
+
+	return 0;
+}
+
+
+static int pmt_load(FILE *f)
+{
+	char line[128], type;
+	unsigned long a, b, c;
+	unsigned int lineno = 0;
+	int n, err = 0;
+
+	while (err == 0 && fgets(line, sizeof(line), f) != NULL) {
+		lineno++;
+
+		if ((n = sscanf(line, " %c %lu %lu %lu", &type, &a, &b, &c)) < 1 || type == '#')
+			continue;
+
+		if (n >= 2 && a >= PMT_MAXSLOTS) {
+			fprintf(stderr, "pmt: slot id %lu at line %u exceeds %u\n", a, lineno, PMT_MAXSLOTS - 1);
+			err = -ERANGE;
+			break;
+		}
+
+		switch (type) {
+			case 'm':
+			case 'r':
+				err = (n == 3) ? pmt_add(type, a, 1, b) : -EINVAL;
+				break;
+
+			case 'c':
+				err = (n == 4) ? pmt_add(type, a, b, c) : -EINVAL;
+				break;
+
+			case 'f':
+				err = (n >= 2) ? pmt_add(type, a, 0, 0) : -EINVAL;
+				break;
+
+			default:
+				err = -EINVAL;
+				break;
+		}
+
+		if (err == -EINVAL)
+			fprintf(stderr, "pmt: malformed event at line %u: %s", lineno, line);
+	}
+
+	return err;
+}
+
+
+/* Synthetic trace, the fixed malloc/calloc/realloc/free script pmt used to run */
+static int pmt_synthetic(unsigned int count, size_t max_size)
+{
+	unsigned int i;
+	size_t size;
+	int err = 0;
+
+	for (i = 0; err == 0 && i < count; ++i) {
+		size = 0x20 * i + 0x50;
+		err = pmt_add('m', i, 1, size > max_size ? max_size : size);
+	}
+
+	for (i = 16; err == 0 && i < count; ++i)
+		err = pmt_add('f', i, 0, 0);
+
+	for (i = 16; err == 0 && i < count; ++i) {
+		size = 0x20 * i + 0x50;
+		err = pmt_add('c', i, (size > max_size ? max_size : size) / 4, 2);
+	}
+
+	for (i = 0; err == 0 && i < count; i += 2) {
+		size = 0x20 * i + 0x90;
+		err = pmt_add('r', i, 1, size > max_size ? max_size : size);
+	}
+
+	for (i = 0; err == 0 && i < count / 2; ++i)
+		err = pmt_add('f', i, 0, 0);
+
+	for (i = 0; err == 0 && i < count / 2; ++i) {
+		size = 0x11 * i + 0x20;
+		err = pmt_add('m', i, 1, size > max_size ? max_size : size);
+	}
+
+	for (i = 0; err == 0 && i < count; ++i)
+		err = pmt_add('f', i, 0, 0);
+
+	return err;
+}
+
+
+static void pmt_dump(void)
+{
+	pmt_event_t *ev;
+	size_t i;
+
+	for (i = 0; i < pmt_common.nevents; i++) {
+		ev = &pmt_common.events[i];
+
+		switch (ev->type) {
+			case 'c':
+				printf("c %u %zu %zu\n", ev->id, ev->nmemb, ev->size);
+				break;
+
+			case 'f':
+				printf("f %u\n", ev->id);
+				break;
+
+			default:
+				printf("%c %u %zu\n", ev->type, ev->id, ev->size);
+				break;
+		}
+	}
+}
+
+
+static int pmt_rangecmp(const void *a, const void *b)
+{
+	uintptr_t x = *(const uintptr_t *)a, y = *(const uintptr_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+
+/*
+ * Fragmentation is the unused fraction of pages spanned by live blocks,
+ * it grows when live data gets scattered among partially used pages
+ */
+static float pmt_fragmentation(uintptr_t *ranges)
+{
+	uintptr_t start, end = 0;
+	size_t pages = 0;
+	unsigned int i, n = 0;
+
+	for (i = 0; i < pmt_common.nslots; i++) {
+		if (pmt_common.slots[i].ptr == NULL || pmt_common.slots[i].size == 0)
+			continue;
+
+		start = (uintptr_t)pmt_common.slots[i].ptr;
+		ranges[2 * n] = start & ~(uintptr_t)(_PAGE_SIZE - 1);
+		ranges[2 * n + 1] = (start + pmt_common.slots[i].size + _PAGE_SIZE - 1) & ~(uintptr_t)(_PAGE_SIZE - 1);
+		n++;
+	}
+
+	if (n == 0)
+		return 0;
+
+	qsort(ranges, n, 2 * sizeof(*ranges), pmt_rangecmp);
+
+	for (i = 0; i < n; i++) {
+		start = (ranges[2 * i] > end) ? ranges[2 * i] : end;
+		if (ranges[2 * i + 1] > start) {
+			pages += (ranges[2 * i + 1] - start) / _PAGE_SIZE;
+			end = ranges[2 * i + 1];
+		}
+	}
+
+	return 100 * (1 - (float)pmt_common.live / (pages * _PAGE_SIZE));
+}
+
+
+static void pmt_checkpoint(uintptr_t *ranges)
+{
+	pmt_common.frag = pmt_fragmentation(ranges);
+	if (pmt_common.frag > pmt_common.maxfrag)
+		pmt_common.maxfrag = pmt_common.frag;
+}
+
+
+static void pmt_account(pmt_slot_t *slot, void *ptr, size_t size)
+{
+	if (ptr == NULL) {
+		pmt_common.failed++;
+		return;
+	}
+
+	if (slot->ptr == NULL)
+		pmt_common.blocks++;
+
+	pmt_common.live += size - slot->size;
+	slot->ptr = ptr;
+	slot->size = size;
+
+	if (pmt_common.live > pmt_common.peak) {
+		pmt_common.peak = pmt_common.live;
+		pmt_common.peakblocks = pmt_common.blocks;
+	}
+
+	if (pmt_common.touch)
+		memset(ptr, 0xff, size);
+}
+
+
+static int pmt_replay(void)
+{
+	pmt_event_t *ev;
+	pmt_slot_t *slot;
+	uintptr_t *ranges;
+	time_t start, end, elapsed = 0;
+	unsigned int i;
+	void *ptr;
+	size_t n;
+	int err = 0;
+
+	pmt_common.slots = calloc(pmt_common.nslots, sizeof(*pmt_common.slots));
+	ranges = malloc(2 * pmt_common.nslots * sizeof(*ranges));
+
+	if (pmt_common.slots == NULL || ranges == NULL) {
+		fprintf(stderr, "pmt: out of memory (%u slots)\n", pmt_common.nslots);
+		free(pmt_common.slots);
+		free(ranges);
+		return -ENOMEM;
+	}
+
+	/* Checkpoints are excluded from the measured time */
+	for (n = 0; n < pmt_common.nevents;) {
+		gettime(&start, NULL);
+
+		do {
+			ev = &pmt_common.events[n];
+			slot = &pmt_common.slots[ev->id];
+
+			switch (ev->type) {
+				case 'm':
+					if (slot->ptr != NULL) {
+						err = -EINVAL;
+						break;
+					}
+					pmt_account(slot, malloc(ev->size), ev->size);
+					break;
+
+				case 'c':
+					if (slot->ptr != NULL) {
+						err = -EINVAL;
+						break;
+					}
+					pmt_account(slot, calloc(ev->nmemb, ev->size), ev->nmemb * ev->size);
+					break;
+
+				case 'r':
+					/* Failed realloc leaves the original block untouched */
+					ptr = realloc(slot->ptr, ev->size);
+					if (ptr == NULL && ev->size == 0) {
+						pmt_common.live -= slot->size;
+						pmt_common.blocks -= (slot->ptr != NULL);
+						slot->ptr = NULL;
+						slot->size = 0;
+					}
+					else {
+						pmt_account(slot, ptr, ev->size);
+					}
+					break;
+
+				case 'f':
+					free(slot->ptr);
+					pmt_common.live -= slot->size;
+					pmt_common.blocks -= (slot->ptr != NULL);
+					slot->ptr = NULL;
+					slot->size = 0;
+					break;
+			}
+
+			pmt_common.ops[strchr(pmt_types, ev->type) - pmt_types]++;
+		} while (err == 0 && ++n < pmt_common.nevents && (n % pmt_common.interval) != 0);
+
+		gettime(&end, NULL);
+		elapsed += end - start;
+
+		if (err < 0) {
+			fprintf(stderr, "pmt: event %zu allocates live slot %u\n", n, ev->id);
+			break;
+		}
+
+		pmt_checkpoint(ranges);
+	}
+
+	/* Release blocks left allocated by the trace */
+	for (i = 0; i < pmt_common.nslots; i++)
+		free(pmt_common.slots[i].ptr);
+
+	if (err < 0) {
+		free(ranges);
+		free(pmt_common.slots);
+		return err;
+	}
+
+	printf("pmt: replayed %zu events (malloc %u, calloc %u, realloc %u, free %u, failed %u) in %llu us",
+		pmt_common.nevents, pmt_common.ops[0], pmt_common.ops[1], pmt_common.ops[2], pmt_common.ops[3], pmt_common.failed,
+		(unsigned long long)elapsed);
+	if (elapsed != 0)
+		printf(", %llu ops/s", (unsigned long long)pmt_common.nevents * 1000000 / elapsed);
+	printf("\n");
+	printf("pmt: peak heap %zu bytes in %u blocks, %zu bytes in %u blocks left by trace\n",
+		pmt_common.peak, pmt_common.peakblocks, pmt_common.live, pmt_common.blocks);
+	printf("pmt: fragmentation max %.2f%%, final %.2f%% (checked every %u events)\n",
+		pmt_common.maxfrag, pmt_common.frag, pmt_common.interval);
+
+	free(ranges);
+	free(pmt_common.slots);
+
+	return 0;
+}
+
+
+static void pmt_help(const char *prog)
+{
+	printf("Usage: %s [options] [trace]\n", prog);
+	printf("\tReplays allocation trace file ('-' for stdin) or built-in synthetic trace\n");
+	printf("\t-c count    - synthetic trace buffers count (default 33)\n");
+	printf("\t-s size     - synthetic trace max buffer size (default 65)\n");
+	printf("\t-g          - print trace instead of replaying it\n");
+	printf("\t-i events   - fragmentation checkpoint interval (default 1024)\n");
+	printf("\t-n          - don't touch allocated memory\n");
+	printf("\t-h          - prints this help message\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int count = 33;
+	size_t max_size = 65;
+	int c, err, gen = 0;
+	FILE *f;
+
+	pmt_common.touch = 1;
+	pmt_common.interval = 1024;
+
+	while ((c = getopt(argc, argv, "c:s:gi:nh")) != -1) {
+		switch (c) {
+			case 'c':
+				count = strtoul(optarg, NULL, 0);
+				break;
+
+			case 's':
+				max_size = strtoul(optarg, NULL, 0);
+				break;
+
+			case 'g':
+				gen = 1;
+				break;
+
+			case 'i':
+				if ((pmt_common.interval = strtoul(optarg, NULL, 0)) == 0)
+					pmt_common.interval = 1;
+				break;
+
+			case 'n':
+				pmt_common.touch = 0;
+				break;
+
+			case 'h':
+			default:
+				pmt_help(argv[0]);
+				return 0;
+		}
+	}
+
+	if (optind < argc) {
+		if (strcmp(argv[optind], "-") == 0) {
+			f = stdin;
+		}
+		else if ((f = fopen(argv[optind], "r")) == NULL) {
+			fprintf(stderr, "pmt: can't open %s (%s)\n", argv[optind], strerror(errno));
+			return 1;
+		}
+
+		err = pmt_load(f);
+
+		if (f != stdin)
+			fclose(f);
+	}
+	else {
+		err = pmt_synthetic(count, max_size);
+	}
+
+	if (err < 0) {
+		fprintf(stderr, "pmt: failed to load trace (%s)\n", strerror(-err));
+		free(pmt_common.events);
+		return 1;
+	}
+
+	if (gen)
+		pmt_dump();
+	else
+		err = pmt_replay();
+
+	free(pmt_common.events);
+
+	return err < 0 ? 1 : 0;
+}
@@ -0,0 +1,494 @@
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/test_memfuzz
+ *
+ * Differential fuzzing of mem* routines against byte-loop references
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "unity_fixture.h"
+
+/* Default seed, can be overridden with MEMFUZZ_SEED environment variable */
+#define FUZZ_SEED   1581072278
+#define FUZZ_ALIGN  64
+#define FUZZ_PAGES  4
+#define FUZZ_SIZE   (FUZZ_PAGES * _PAGE_SIZE)
+#define FUZZ_MAXLEN (3 * _PAGE_SIZE)
+#define FUZZ_ITERS  1000
+#define FUZZ_CANARY 0xa5
+
+
+enum { fuzz_head = 0, fuzz_tail, fuzz_cross, fuzz_placements };
+
+
+static struct {
+	unsigned char *map;    /* guard page + arena + guard page */
+	unsigned char *arena;  /* memory under test */
+	unsigned char *ref;    /* shadow copy modified by reference routines */
+	int guarded;           /* guard pages are unmapped, overruns fault */
+	unsigned seed;
+
+	/* Current operation, reported on failure */
+	const char *op;
+	unsigned iter;
+	size_t src, dst, len;
+	int c;
+	char msg[192];
+} memfuzz_common;
+
+
+/* Reference implementations */
+
+
+static void ref_memmove(unsigned char *dst, const unsigned char *src, size_t len)
+{
+	size_t i;
+
+	if (dst < src) {
+		for (i = 0; i < len; i++)
+			dst[i] = src[i];
+	}
+	else {
+		for (i = len; i > 0; i--)
+			dst[i - 1] = src[i - 1];
+	}
+}
+
+
+static void ref_memset(unsigned char *dst, int c, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		dst[i] = (unsigned char)c;
+}
+
+
+static int ref_memcmp(const unsigned char *s1, const unsigned char *s2, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (s1[i] != s2[i])
+			return (s1[i] < s2[i]) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+
+static const unsigned char *ref_memchr(const unsigned char *s, int c, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (s[i] == (unsigned char)c)
+			return s + i;
+	}
+
+	return NULL;
+}
+
+
+static int fuzz_sign(int v)
+{
+	return (v > 0) - (v < 0);
+}
+
+
+/* Helpers */
+
+
+static void fuzz_fail(const char *what)
+{
+	snprintf(memfuzz_common.msg, sizeof(memfuzz_common.msg), "%s: %s (seed %u iter %u src %zu dst %zu len %zu c 0x%x guarded %d)",
+		memfuzz_common.op, what, memfuzz_common.seed, memfuzz_common.iter, memfuzz_common.src, memfuzz_common.dst,
+		memfuzz_common.len, memfuzz_common.c, memfuzz_common.guarded);
+	TEST_FAIL_MESSAGE(memfuzz_common.msg);
+}
+
+
+static void fuzz_op(const char *op, unsigned iter, size_t src, size_t dst, size_t len, int c)
+{
+	memfuzz_common.op = op;
+	memfuzz_common.iter = iter;
+	memfuzz_common.src = src;
+	memfuzz_common.dst = dst;
+	memfuzz_common.len = len;
+	memfuzz_common.c = c;
+}
+
+
+/* Compares arena against the reference copy in [lo, hi) */
+static void fuzz_verify(size_t lo, size_t hi)
+{
+	char what[64];
+	size_t i;
+
+	for (i = lo; i < hi; i++) {
+		if (memfuzz_common.arena[i] != memfuzz_common.ref[i]) {
+			snprintf(what, sizeof(what), "byte %zu is 0x%02x, expected 0x%02x", i, memfuzz_common.arena[i], memfuzz_common.ref[i]);
+			fuzz_fail(what);
+		}
+	}
+}
+
+
+/* Checks [offs, offs + len) written by the last operation together with FUZZ_ALIGN guard bytes on each side */
+static void fuzz_verifyWindow(size_t offs, size_t len)
+{
+	size_t lo = (offs > FUZZ_ALIGN) ? offs - FUZZ_ALIGN : 0;
+	size_t hi = (offs + len + FUZZ_ALIGN < FUZZ_SIZE) ? offs + len + FUZZ_ALIGN : FUZZ_SIZE;
+
+	fuzz_verify(lo, hi);
+}
+
+
+/* Checks whole arena and guard canaries, catches stray writes outside of verified windows */
+static void fuzz_verifyAll(void)
+{
+	size_t i;
+
+	fuzz_verify(0, FUZZ_SIZE);
+
+	if (memfuzz_common.guarded)
+		return;
+
+	for (i = 0; i < _PAGE_SIZE; i++) {
+		if (memfuzz_common.map[i] != FUZZ_CANARY || memfuzz_common.arena[FUZZ_SIZE + i] != FUZZ_CANARY)
+			fuzz_fail("guard area overwritten");
+	}
+}
+
+
+/* Randomizes [offs, offs + len) in both arena and reference copy */
+static void fuzz_randomize(size_t offs, size_t len)
+{
+	size_t i;
+
+	for (i = offs; i < offs + len; i++)
+		memfuzz_common.arena[i] = memfuzz_common.ref[i] = (unsigned char)rand_r(&memfuzz_common.seed);
+}
+
+
+static size_t fuzz_len(void)
+{
+	switch (rand_r(&memfuzz_common.seed) % 4) {
+		case 0:
+			return rand_r(&memfuzz_common.seed) % 16;
+		case 1:
+			return rand_r(&memfuzz_common.seed) % (4 * FUZZ_ALIGN);
+		case 2:
+			return rand_r(&memfuzz_common.seed) % _PAGE_SIZE;
+		default:
+			return rand_r(&memfuzz_common.seed) % (FUZZ_MAXLEN + 1);
+	}
+}
+
+
+/* Returns offset of span bytes placed at arena head, tail or across a page boundary */
+static size_t fuzz_place(size_t span)
+{
+	size_t offs, back, misalign = rand_r(&memfuzz_common.seed) % FUZZ_ALIGN;
+
+	if (span + misalign > FUZZ_SIZE)
+		misalign = FUZZ_SIZE - span;
+
+	switch (rand_r(&memfuzz_common.seed) % fuzz_placements) {
+		case fuzz_head:
+			return misalign;
+
+		case fuzz_tail:
+			return FUZZ_SIZE - span - misalign;
+
+		default:
+			offs = _PAGE_SIZE * (1 + rand_r(&memfuzz_common.seed) % (FUZZ_PAGES - 1));
+			back = rand_r(&memfuzz_common.seed) % (span + 1);
+			offs = (back > offs) ? 0 : offs - back;
+			return (offs + span > FUZZ_SIZE) ? FUZZ_SIZE - span : offs;
+	}
+}
+
+
+/* Places len-sized src and dst; overlapping if overlap != 0 */
+static void fuzz_place2(size_t len, int overlap, size_t *src, size_t *dst)
+{
+	size_t dist, base;
+
+	if (overlap)
+		dist = rand_r(&memfuzz_common.seed) % (len + 1);
+	else
+		dist = len + rand_r(&memfuzz_common.seed) % FUZZ_ALIGN;
+
+	if (len + dist > FUZZ_SIZE)
+		dist = FUZZ_SIZE - len;
+
+	base = fuzz_place(len + dist);
+
+	if (rand_r(&memfuzz_common.seed) % 2) {
+		*src = base;
+		*dst = base + dist;
+	}
+	else {
+		*src = base + dist;
+		*dst = base;
+	}
+}
+
+
+static void fuzz_exhaustive(const char *op, int overlap, size_t srcbase, size_t dstbase)
+{
+	static const size_t lens[] = { 0, 1, 2, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 255, 256, 257 };
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	size_t sa, da, i, src, dst, len;
+	unsigned iter = 0;
+
+	for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+		len = lens[i];
+		for (sa = 0; sa < FUZZ_ALIGN; sa++) {
+			for (da = 0; da < FUZZ_ALIGN; da++, iter++) {
+				src = srcbase + sa;
+				dst = dstbase + da;
+				fuzz_op(op, iter, src, dst, len, 0);
+
+				ref_memmove(ref + dst, ref + src, len);
+				if (overlap)
+					TEST_ASSERT_EQUAL_PTR(arena + dst, memmove(arena + dst, arena + src, len));
+				else
+					TEST_ASSERT_EQUAL_PTR(arena + dst, memcpy(arena + dst, arena + src, len));
+
+				fuzz_verifyWindow(dst, len);
+				fuzz_randomize(dst, len);
+			}
+		}
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST_GROUP(test_memfuzz);
+
+
+TEST_SETUP(test_memfuzz)
+{
+	char *seed = getenv("MEMFUZZ_SEED");
+	size_t mapsz = FUZZ_SIZE + 2 * _PAGE_SIZE;
+
+	memfuzz_common.seed = (seed != NULL) ? strtoul(seed, NULL, 0) : FUZZ_SEED;
+
+	memfuzz_common.map = mmap(NULL, mapsz, PROT_READ | PROT_WRITE, MAP_PRIVATE, NULL, 0);
+	TEST_ASSERT_MESSAGE(memfuzz_common.map != (void *)-1 && memfuzz_common.map != NULL, "arena mmap failed");
+
+	memfuzz_common.ref = malloc(FUZZ_SIZE);
+	TEST_ASSERT_NOT_NULL(memfuzz_common.ref);
+
+	memfuzz_common.arena = memfuzz_common.map + _PAGE_SIZE;
+	ref_memset(memfuzz_common.map, FUZZ_CANARY, mapsz);
+	fuzz_randomize(0, FUZZ_SIZE);
+
+	/* Without MMU unmapping may fail, canaries are checked instead */
+	memfuzz_common.guarded = (munmap(memfuzz_common.arena + FUZZ_SIZE, _PAGE_SIZE) == 0);
+	if (memfuzz_common.guarded)
+		TEST_ASSERT_EQUAL_INT(0, munmap(memfuzz_common.map, _PAGE_SIZE));
+}
+
+
+TEST_TEAR_DOWN(test_memfuzz)
+{
+	if (memfuzz_common.guarded)
+		munmap(memfuzz_common.arena, FUZZ_SIZE);
+	else
+		munmap(memfuzz_common.map, FUZZ_SIZE + 2 * _PAGE_SIZE);
+
+	free(memfuzz_common.ref);
+}
+
+
+TEST(test_memfuzz, memcpy_align)
+{
+	/* Both buffers cross a page boundary for longer copies */
+	fuzz_exhaustive("memcpy", 0, _PAGE_SIZE - FUZZ_ALIGN, 3 * _PAGE_SIZE - FUZZ_ALIGN);
+}
+
+
+TEST(test_memfuzz, memmove_align)
+{
+	fuzz_exhaustive("memmove", 1, 2 * _PAGE_SIZE - FUZZ_ALIGN, 2 * _PAGE_SIZE - FUZZ_ALIGN);
+}
+
+
+TEST(test_memfuzz, memcpy)
+{
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	size_t src, dst, len;
+	unsigned i;
+
+	for (i = 0; i < FUZZ_ITERS; i++) {
+		len = fuzz_len();
+		if (len > FUZZ_SIZE / 2 - FUZZ_ALIGN)
+			len = FUZZ_SIZE / 2 - FUZZ_ALIGN;
+
+		fuzz_place2(len, 0, &src, &dst);
+		fuzz_op("memcpy", i, src, dst, len, 0);
+
+		ref_memmove(ref + dst, ref + src, len);
+		TEST_ASSERT_EQUAL_PTR(arena + dst, memcpy(arena + dst, arena + src, len));
+
+		fuzz_verifyWindow(dst, len);
+		fuzz_randomize(dst, len);
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST(test_memfuzz, memmove)
+{
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	size_t src, dst, len;
+	unsigned i;
+
+	for (i = 0; i < FUZZ_ITERS; i++) {
+		len = fuzz_len();
+		fuzz_place2(len, rand_r(&memfuzz_common.seed) % 4, &src, &dst);
+		fuzz_op("memmove", i, src, dst, len, 0);
+
+		ref_memmove(ref + dst, ref + src, len);
+		TEST_ASSERT_EQUAL_PTR(arena + dst, memmove(arena + dst, arena + src, len));
+
+		fuzz_verifyWindow(dst, len);
+		fuzz_randomize(dst, len);
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST(test_memfuzz, memset)
+{
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	size_t dst, len;
+	unsigned i;
+	int c;
+
+	for (i = 0; i < FUZZ_ITERS; i++) {
+		len = fuzz_len();
+		dst = fuzz_place(len);
+		/* Only the low byte of c may be used */
+		c = rand_r(&memfuzz_common.seed);
+		fuzz_op("memset", i, 0, dst, len, c);
+
+		ref_memset(ref + dst, c, len);
+		TEST_ASSERT_EQUAL_PTR(arena + dst, memset(arena + dst, c, len));
+
+		fuzz_verifyWindow(dst, len);
+		fuzz_randomize(dst, len);
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST(test_memfuzz, memcmp)
+{
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	size_t s1, s2, len, pos;
+	unsigned i;
+
+	for (i = 0; i < FUZZ_ITERS; i++) {
+		len = fuzz_len();
+		if (len > FUZZ_SIZE / 2 - FUZZ_ALIGN)
+			len = FUZZ_SIZE / 2 - FUZZ_ALIGN;
+
+		fuzz_place2(len, 0, &s1, &s2);
+		ref_memmove(ref + s2, ref + s1, len);
+		ref_memmove(arena + s2, arena + s1, len);
+
+		/* Introduce a single difference, exercising both signs and bytes above 0x7f */
+		if (len != 0 && rand_r(&memfuzz_common.seed) % 4) {
+			pos = rand_r(&memfuzz_common.seed) % len;
+			ref[s2 + pos] = arena[s2 + pos] = arena[s1 + pos] ^ (1 + rand_r(&memfuzz_common.seed) % 255);
+		}
+
+		fuzz_op("memcmp", i, s1, s2, len, 0);
+		if (fuzz_sign(memcmp(arena + s1, arena + s2, len)) != ref_memcmp(ref + s1, ref + s2, len))
+			fuzz_fail("wrong result");
+
+		fuzz_verifyWindow(s2, len);
+		fuzz_randomize(s2, len);
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST(test_memfuzz, memchr)
+{
+	unsigned char *arena = memfuzz_common.arena, *ref = memfuzz_common.ref;
+	const unsigned char *res, *expected;
+	size_t src, len, pos;
+	unsigned i;
+	int c;
+
+	for (i = 0; i < FUZZ_ITERS; i++) {
+		len = fuzz_len();
+		src = fuzz_place(len);
+		/* High bits of c have to be ignored */
+		c = rand_r(&memfuzz_common.seed);
+
+		if (len != 0 && rand_r(&memfuzz_common.seed) % 2) {
+			pos = rand_r(&memfuzz_common.seed) % len;
+			ref[src + pos] = arena[src + pos] = (unsigned char)c;
+		}
+
+		fuzz_op("memchr", i, src, 0, len, c);
+		res = memchr(arena + src, c, len);
+		expected = ref_memchr(ref + src, c, len);
+
+		if ((expected == NULL) ? (res != NULL) : (res != arena + (expected - ref)))
+			fuzz_fail("wrong result");
+
+		fuzz_verifyWindow(src, len);
+	}
+
+	fuzz_verifyAll();
+}
+
+
+TEST_GROUP_RUNNER(test_memfuzz)
+{
+	RUN_TEST_CASE(test_memfuzz, memcpy_align);
+	RUN_TEST_CASE(test_memfuzz, memmove_align);
+	RUN_TEST_CASE(test_memfuzz, memcpy);
+	RUN_TEST_CASE(test_memfuzz, memmove);
+	RUN_TEST_CASE(test_memfuzz, memset);
+	RUN_TEST_CASE(test_memfuzz, memcmp);
+	RUN_TEST_CASE(test_memfuzz, memchr);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(test_memfuzz);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
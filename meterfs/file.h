@@ -41,6 +41,28 @@ int file_getInfo(id_t fid, size_t *sectors, size_t *filesz, size_t *recordsz, si
 int file_eraseAll(void);
 
 
+/* Copies per sector erase and programmed bytes counters of first sectors, returns number of sectors copied */
+int file_wearGet(unsigned int *erases, size_t *programmed, size_t sectors);
+
+
+/* Clears wear counters, flash wear is counted only from the first call on */
+void file_wearReset(void);
+
+
+enum { file_cutTruncate = 1, file_cutCorrupt };
+
+
+/*
+ * Cuts power during the next modifying call, so only part of its flash changes reach the flash image.
+ * Meterfs state in memory is stale afterwards, caller should _exit() and reinitialize from a new process.
+ */
+int file_powerCut(int mode, unsigned int seed);
+
+
 void file_init(const char *path);
 
+
+/* Returns 1 if calls are serialized by this abstraction rather than by the filesystem server itself */
+int file_serialized(void);
+
 #endif
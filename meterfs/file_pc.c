@@ -9,8 +9,16 @@
  * %LICENSE%
  */
 
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <host-flashsrv.h>
 #include <meterfs.h>
 
@@ -19,11 +27,144 @@
 #define FLASHSIZE (4 * 1024 * 1024)
 #define SECTORSIZE (4 * 1024)
 
+
+/*
+ * Flash wear is tracked and power cuts are injected by diffing emulated flash image against its copy after modifying
+ * calls. Mapping and diffing whole flash is slow, so it's done only once enabled by file_wearReset() or file_powerCut().
+ * Host-flash isn't thread safe, so its calls are serialized here, modifying ones together with their diff.
+ */
+static struct {
+	pthread_mutex_t srvlock;
+	pthread_mutex_t lock;
+	char path[PATH_MAX];
+	unsigned char *flash;
+	unsigned char *shadow;
+	unsigned int erases[FLASHSIZE / SECTORSIZE];
+	size_t programmed[FLASHSIZE / SECTORSIZE];
+	int tracking;
+	int cut;
+	unsigned int seed;
+} file_common = { .srvlock = PTHREAD_MUTEX_INITIALIZER, .lock = PTHREAD_MUTEX_INITIALIZER };
+
+
+/* Returns byte state between old and new one, with random part of bit transitions done */
+static unsigned char file_cutPartial(unsigned char old, unsigned char new)
+{
+	unsigned char up = new & ~old, down = old & ~new;
+
+	return (old | (up & rand_r(&file_common.seed))) & ~(down & rand_r(&file_common.seed));
+}
+
+
+/*
+ * Keeps only random number of changed bytes, in address order, of the last call. Bytes after the cut are
+ * reverted to their previous state, with corrupt mode rest of the sector cut in is left half programmed or erased.
+ * Program order and repeated programs of the same byte within the call aren't visible here, so not every
+ * resulting image is reachable on real flash.
+ */
+static void file_cutApply(void)
+{
+	unsigned char *flash;
+	const unsigned char *shadow;
+	size_t changed = 0, cut, n = 0;
+	unsigned int s, i, torn = 0;
+
+	for (s = 0; s < FLASHSIZE / SECTORSIZE; s++) {
+		flash = file_common.flash + s * SECTORSIZE;
+		shadow = file_common.shadow + s * SECTORSIZE;
+
+		if (memcmp(flash, shadow, SECTORSIZE) == 0)
+			continue;
+
+		for (i = 0; i < SECTORSIZE; i++)
+			changed += (flash[i] != shadow[i]);
+	}
+
+	if (changed == 0)
+		return;
+
+	cut = rand_r(&file_common.seed) % (changed + 1);
+
+	for (s = 0; (s < FLASHSIZE / SECTORSIZE) && (n < changed); s++) {
+		flash = file_common.flash + s * SECTORSIZE;
+		shadow = file_common.shadow + s * SECTORSIZE;
+
+		if (memcmp(flash, shadow, SECTORSIZE) == 0)
+			continue;
+
+		for (i = 0; i < SECTORSIZE; i++) {
+			if (flash[i] == shadow[i])
+				continue;
+
+			if (n++ < cut)
+				continue;
+
+			if (n == cut + 1)
+				torn = (file_common.cut == file_cutCorrupt);
+
+			flash[i] = torn ? file_cutPartial(shadow[i], flash[i]) : shadow[i];
+		}
+		torn = 0;
+	}
+
+	msync(file_common.flash, FLASHSIZE, MS_SYNC);
+	file_common.cut = 0;
+}
+
+
+/* NOR flash bits only go from 1 to 0 when programmed, any 0 to 1 change means sector was erased */
+static void file_wearUpdate(void)
+{
+	const unsigned char *flash;
+	unsigned char *shadow;
+	unsigned int s, i, erased;
+	size_t programmed;
+
+	pthread_mutex_lock(&file_common.lock);
+
+	if (!file_common.tracking) {
+		pthread_mutex_unlock(&file_common.lock);
+		return;
+	}
+
+	if (file_common.cut != 0)
+		file_cutApply();
+
+	for (s = 0; s < FLASHSIZE / SECTORSIZE; s++) {
+		flash = file_common.flash + s * SECTORSIZE;
+		shadow = file_common.shadow + s * SECTORSIZE;
+
+		if (memcmp(flash, shadow, SECTORSIZE) == 0)
+			continue;
+
+		for (i = 0, erased = 0; i < SECTORSIZE && !erased; i++)
+			erased = flash[i] & ~shadow[i];
+
+		/* Bytes programmed with 0xff or with unchanged value are not visible, so counts are lower bounds */
+		for (i = 0, programmed = 0; i < SECTORSIZE; i++) {
+			if (erased ? (flash[i] != 0xff) : (flash[i] != shadow[i]))
+				programmed++;
+		}
+
+		file_common.erases[s] += (erased != 0);
+		file_common.programmed[s] += programmed;
+		memcpy(shadow, flash, SECTORSIZE);
+	}
+
+	pthread_mutex_unlock(&file_common.lock);
+}
+
+
 int file_lookup(const char *name)
 {
 	id_t id;
+	int err;
+
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_lookup(name, &id);
+	pthread_mutex_unlock(&file_common.srvlock);
 
-	return hostflashsrv_lookup(name, &id);
+	return err;
 }
 
 
@@ -32,34 +173,55 @@ int file_open(const char *name)
 	int err;
 	id_t id;
 
-	if ((err = hostflashsrv_lookup(name, &id)) < 0)
-		return err;
+	pthread_mutex_lock(&file_common.srvlock);
 
-	if (id > INT_MAX)
-		return -1;
+	if ((err = hostflashsrv_lookup(name, &id)) >= 0) {
+		if (id > INT_MAX)
+			err = -1;
+		else if ((err = hostflashsrv_open(&id)) >= 0)
+			err = (int)id;
+	}
 
-	if ((err = hostflashsrv_open(&id)) < 0)
-		return err;
+	pthread_mutex_unlock(&file_common.srvlock);
 
-	return (int)id; 
+	return err;
 }
 
 
 int file_close(id_t fid)
 {
-	return hostflashsrv_close(&fid);
+	int err;
+
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_close(&fid);
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
 }
 
 
 int file_write(id_t fid, const void *buff, size_t bufflen)
 {
-	return hostflashsrv_writeFile(&fid, buff, bufflen);
+	int err;
+
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_writeFile(&fid, buff, bufflen);
+	file_wearUpdate();
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
 }
 
 
 int file_read(id_t fid, off_t offset, void *buff, size_t bufflen)
 {
-	return hostflashsrv_readFile(&fid, offset, buff, bufflen);
+	int err;
+
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_readFile(&fid, offset, buff, bufflen);
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
 }
 
 
@@ -67,7 +229,7 @@ int file_allocate(const char *name, size_t sectors, size_t filesz, size_t record
 {
 	meterfs_i_devctl_t iptr;
 	meterfs_o_devctl_t optr;
-	int len = 0;
+	int len = 0, err;
 
 	iptr.type = meterfs_allocate;
 	len = strnlen(name, sizeof(iptr.allocate.name));
@@ -78,7 +240,12 @@ int file_allocate(const char *name, size_t sectors, size_t filesz, size_t record
 	iptr.allocate.filesz = filesz;
 	iptr.allocate.recordsz = recordsz;
 
-	return hostflashsrv_devctl(&iptr, &optr);
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_devctl(&iptr, &optr);
+	file_wearUpdate();
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
 }
 
 
@@ -86,13 +253,19 @@ int file_resize(id_t fid, size_t filesz, size_t recordsz)
 {
 	meterfs_i_devctl_t iptr;
 	meterfs_o_devctl_t optr;
+	int err;
 
 	iptr.type = meterfs_resize;
 	iptr.resize.id = fid;
 	iptr.resize.filesz = filesz;
 	iptr.resize.recordsz = recordsz;
 
-	return hostflashsrv_devctl(&iptr, &optr);
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_devctl(&iptr, &optr);
+	file_wearUpdate();
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
 }
 
 
@@ -105,7 +278,11 @@ int file_getInfo(id_t fid, size_t *sectors, size_t *filesz, size_t *recordsz, si
 	iptr.type = meterfs_info;
 	iptr.id = fid;
 
-	if ((err = hostflashsrv_devctl(&iptr, &optr)) < 0)
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_devctl(&iptr, &optr);
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	if (err < 0)
 		return err;
 
 	if (sectors != NULL)
@@ -128,10 +305,111 @@ int file_eraseAll(void)
 {
 	meterfs_i_devctl_t iptr;
 	meterfs_o_devctl_t optr;
+	int err;
 
 	iptr.type = meterfs_chiperase;
 
-	return hostflashsrv_devctl(&iptr, &optr);
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_devctl(&iptr, &optr);
+	file_wearUpdate();
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	return err;
+}
+
+
+int file_wearGet(unsigned int *erases, size_t *programmed, size_t sectors)
+{
+	if (sectors > FLASHSIZE / SECTORSIZE)
+		sectors = FLASHSIZE / SECTORSIZE;
+
+	pthread_mutex_lock(&file_common.lock);
+
+	if (!file_common.tracking) {
+		pthread_mutex_unlock(&file_common.lock);
+		return -ENOSYS;
+	}
+
+	if (erases != NULL)
+		memcpy(erases, file_common.erases, sectors * sizeof(*erases));
+
+	if (programmed != NULL)
+		memcpy(programmed, file_common.programmed, sectors * sizeof(*programmed));
+
+	pthread_mutex_unlock(&file_common.lock);
+
+	return sectors;
+}
+
+
+/* Maps emulated flash image on first use and starts tracking from its current contents */
+static int file_track(void)
+{
+	struct stat st;
+	void *flash;
+	int fd;
+
+	if (file_common.tracking)
+		return 0;
+
+	if (file_common.flash == NULL) {
+		/* Shared mapping sees emulated flash image contents as host-flash updates them */
+		if ((fd = open(file_common.path, O_RDWR)) < 0)
+			return -ENOSYS;
+
+		if ((fstat(fd, &st) < 0) || (st.st_size < FLASHSIZE)) {
+			close(fd);
+			return -ENOSYS;
+		}
+
+		flash = mmap(NULL, FLASHSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+
+		if (flash == MAP_FAILED)
+			return -ENOSYS;
+
+		if ((file_common.shadow = malloc(FLASHSIZE)) == NULL) {
+			munmap(flash, FLASHSIZE);
+			return -ENOMEM;
+		}
+
+		file_common.flash = flash;
+	}
+
+	memcpy(file_common.shadow, file_common.flash, FLASHSIZE);
+	file_common.tracking = 1;
+
+	return 0;
+}
+
+
+void file_wearReset(void)
+{
+	pthread_mutex_lock(&file_common.lock);
+
+	if (file_track() == 0) {
+		memset(file_common.erases, 0, sizeof(file_common.erases));
+		memset(file_common.programmed, 0, sizeof(file_common.programmed));
+	}
+
+	pthread_mutex_unlock(&file_common.lock);
+}
+
+
+int file_powerCut(int mode, unsigned int seed)
+{
+	int err;
+
+	pthread_mutex_lock(&file_common.lock);
+
+	if ((err = file_track()) == 0) {
+		file_common.cut = mode;
+		file_common.seed = seed;
+	}
+
+	pthread_mutex_unlock(&file_common.lock);
+
+	return err;
 }
 
 
@@ -139,7 +417,22 @@ void file_init(const char *path)
 {
 	size_t filesz = FLASHSIZE;
 	size_t sectorsz = SECTORSIZE;
+	int err;
 
-	if (hostflashsrv_init(&filesz, &sectorsz, path) < 0)
+	pthread_mutex_lock(&file_common.srvlock);
+	err = hostflashsrv_init(&filesz, &sectorsz, path);
+	pthread_mutex_unlock(&file_common.srvlock);
+
+	if (err < 0) {
 		printf("hostflashsrv: init failed\n");
+		return;
+	}
+
+	strncpy(file_common.path, path, sizeof(file_common.path) - 1);
+}
+
+
+int file_serialized(void)
+{
+	return 1;
 }
@@ -9,6 +9,7 @@
  * %LICENSE%
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <sys/msg.h>
 #include <string.h>
@@ -16,7 +17,6 @@
 #include <meterfs.h>
 
 #include "file.h"
-#include "unity_fixture.h"
 
 static oid_t meterfs;
 
@@ -56,7 +56,8 @@ int file_open(const char *name)
 	msg.o.size = 0;
 	msg.i.openclose.flags = 0;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return msg.o.io.err < 0 ? msg.o.io.err : id;
 }
@@ -65,6 +66,7 @@ int file_open(const char *name)
 int file_close(id_t fid)
 {
 	msg_t msg;
+	int err;
 
 	msg.type = mtClose;
 	msg.i.data = NULL;
@@ -74,7 +76,8 @@ int file_close(id_t fid)
 	msg.i.openclose.oid.port = meterfs.port;
 	msg.i.openclose.oid.id = fid;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return msg.o.io.err;
 }
@@ -83,6 +86,7 @@ int file_close(id_t fid)
 int file_write(id_t fid, const void *buff, size_t bufflen)
 {
 	msg_t msg;
+	int err;
 
 	msg.type = mtWrite;
 	msg.i.io.oid.port = meterfs.port;
@@ -96,7 +100,8 @@ int file_write(id_t fid, const void *buff, size_t bufflen)
 	msg.o.data = NULL;
 	msg.o.size = 0;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return msg.o.io.err;
 }
@@ -104,6 +109,7 @@ int file_write(id_t fid, const void *buff, size_t bufflen)
 int file_read(id_t fid, off_t offset, void *buff, size_t bufflen)
 {
 	msg_t msg;
+	int err;
 
 	msg.type = mtRead;
 	msg.i.io.oid.port = meterfs.port;
@@ -116,7 +122,8 @@ int file_read(id_t fid, off_t offset, void *buff, size_t bufflen)
 	msg.i.data = NULL;
 	msg.i.size = 0;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return msg.o.io.err;
 }
@@ -127,7 +134,7 @@ int file_allocate(const char *name, size_t sectors, size_t filesz, size_t record
 	msg_t msg;
 	meterfs_i_devctl_t *iptr = (meterfs_i_devctl_t *)msg.i.raw;
 	meterfs_o_devctl_t *optr = (meterfs_o_devctl_t *)msg.o.raw;
-	int len = 0;
+	int len = 0, err;
 
 	file_prepareDevCtl(&msg);
 
@@ -140,7 +147,8 @@ int file_allocate(const char *name, size_t sectors, size_t filesz, size_t record
 	iptr->allocate.filesz = filesz;
 	iptr->allocate.recordsz = recordsz;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return optr->err;
 }
@@ -151,6 +159,7 @@ int file_resize(id_t fid, size_t filesz, size_t recordsz)
 	msg_t msg;
 	meterfs_i_devctl_t *iptr = (meterfs_i_devctl_t *)msg.i.raw;
 	meterfs_o_devctl_t *optr = (meterfs_o_devctl_t *)msg.o.raw;
+	int err;
 
 	file_prepareDevCtl(&msg);
 
@@ -159,7 +168,8 @@ int file_resize(id_t fid, size_t filesz, size_t recordsz)
 	iptr->resize.filesz = filesz;
 	iptr->resize.recordsz = recordsz;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return optr->err;
 }
@@ -170,13 +180,15 @@ int file_getInfo(id_t fid, size_t *sectors, size_t *filesz, size_t *recordsz, si
 	msg_t msg;
 	meterfs_i_devctl_t *iptr = (meterfs_i_devctl_t *)msg.i.raw;
 	meterfs_o_devctl_t *optr = (meterfs_o_devctl_t *)msg.o.raw;
+	int err;
 
 	file_prepareDevCtl(&msg);
 
 	iptr->type = meterfs_info;
 	iptr->id = fid;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	if (optr->err < 0)
 		return optr->err;
@@ -202,17 +214,37 @@ int file_eraseAll(void)
 	msg_t msg;
 	meterfs_i_devctl_t *iptr = (meterfs_i_devctl_t *)msg.i.raw;
 	meterfs_o_devctl_t *optr = (meterfs_o_devctl_t *)msg.o.raw;
+	int err;
 
 	file_prepareDevCtl(&msg);
 
 	iptr->type = meterfs_chiperase;
 
-	TEST_ASSERT_EQUAL(0, msgSend(meterfs.port, &msg));
+	if ((err = msgSend(meterfs.port, &msg)) < 0)
+		return err;
 
 	return optr->err;
 }
 
 
+/* Flash wear counters and power cuts are available on host flash emulation only */
+int file_wearGet(unsigned int *erases, size_t *programmed, size_t sectors)
+{
+	return -ENOSYS;
+}
+
+
+void file_wearReset(void)
+{
+}
+
+
+int file_powerCut(int mode, unsigned int seed)
+{
+	return -ENOSYS;
+}
+
+
 void file_init(const char *path)
 {
 	int err;
@@ -220,3 +252,9 @@ void file_init(const char *path)
 	if ((err = lookup(path, NULL, &meterfs)) < 0)
 		return err;
 }
+
+
+int file_serialized(void)
+{
+	return 0;
+}
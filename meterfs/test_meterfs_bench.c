@@ -0,0 +1,186 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Meterfs throughput and latency benchmark
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file.h"
+#include "../test_common.h"
+
+#define BENCH_SECTORSZ 4096 /* Flash sector size, as in file_pc.c */
+#define BENCH_SAMPLES  200  /* Read and getInfo samples per fill level */
+#define BENCH_MAXREC   1024
+
+
+/* Benchmarked file geometries */
+static const struct {
+	size_t filesz;
+	size_t recordsz;
+} bench_geoms[] = {
+	{ 4096, 16 }, { 4096, 256 }, { 65536, 16 }, { 65536, 64 }, { 65536, 256 }, { 262144, 1024 }
+};
+
+
+/* Fill levels in percent of file capacity, above 100 file wraps around dropping oldest records */
+static const unsigned int bench_fills[] = { 25, 50, 100, 200 };
+
+
+static struct {
+	unsigned char buff[BENCH_MAXREC];
+	uint64_t samples[BENCH_SAMPLES];
+	uint64_t *appends;
+} bench_common;
+
+
+/* Records carry their sequence number, the rest is derived from it */
+static void bench_record(unsigned char *buff, size_t recordsz, uint32_t seq)
+{
+	size_t i;
+
+	memcpy(buff, &seq, sizeof(seq));
+	for (i = sizeof(seq); i < recordsz; i++)
+		buff[i] = seq + i;
+}
+
+
+/* Leaves room for meterfs record headers and a spare sector */
+static size_t bench_sectors(size_t filesz, size_t recordsz)
+{
+	return (filesz / recordsz) * (recordsz + 32) / BENCH_SECTORSZ + 3;
+}
+
+
+static uint64_t bench_pct(uint64_t *samples, unsigned int n, unsigned int pct)
+{
+	qsort(samples, n, sizeof(*samples), bench_cmp);
+
+	return bench_percentile(samples, n, pct);
+}
+
+
+static int bench_geom(size_t filesz, size_t recordsz)
+{
+	size_t capacity = filesz / recordsz, written = 0, target, cnt, info, sectors = bench_sectors(filesz, recordsz);
+	unsigned int i, f, n, idx;
+	uint64_t t, total, p50, p99;
+	uint32_t seq;
+	int fd, err;
+
+	if ((bench_common.appends = malloc(capacity * sizeof(uint64_t))) == NULL)
+		return -ENOMEM;
+
+	if (((err = file_allocate("bench", sectors, filesz, recordsz)) < 0) || ((err = file_open("/bench")) < 0)) {
+		printf("test_meterfs_bench: failed to create %zu sector file %zu/%zu (%d)\n", sectors, filesz, recordsz, err);
+		free(bench_common.appends);
+		return err;
+	}
+	fd = err;
+
+	for (f = 0; f < sizeof(bench_fills) / sizeof(bench_fills[0]); f++) {
+		target = capacity * bench_fills[f] / 100;
+
+		/* Append rate up to fill level */
+		total = bench_time();
+		for (n = 0; written < target; written++) {
+			bench_record(bench_common.buff, recordsz, written);
+			t = bench_time();
+			if ((err = file_write(fd, bench_common.buff, recordsz)) != (int)recordsz) {
+				printf("test_meterfs_bench: write of record %zu failed (%d)\n", written, err);
+				err = -EIO;
+				break;
+			}
+			t = bench_time() - t;
+			if (n < capacity)
+				bench_common.appends[n++] = t;
+		}
+		total = bench_time() - total;
+		if (written < target)
+			break;
+
+		p50 = bench_pct(bench_common.appends, n, 50);
+		p99 = bench_percentile(bench_common.appends, n, 99);
+		total = total ? total : 1;
+		printf("test_meterfs_bench: file %zu rec %zu fill %u%%: append %" PRIu64 " rec/s %" PRIu64 " KB/s (p50 %" PRIu64 " p99 %" PRIu64 " us)\n",
+			filesz, recordsz, bench_fills[f], (uint64_t)n * 1000000 / total, (uint64_t)n * recordsz * 1000000 / 1024 / total, p50, p99);
+
+		/* Random reads, offsets count from the oldest record kept */
+		cnt = (written < capacity) ? written : capacity;
+		for (i = 0; i < BENCH_SAMPLES; i++) {
+			idx = rand() % cnt;
+			t = bench_time();
+			err = file_read(fd, idx * recordsz, bench_common.buff, recordsz);
+			bench_common.samples[i] = bench_time() - t;
+
+			memcpy(&seq, bench_common.buff, sizeof(seq));
+			if ((err != (int)recordsz) || (seq != written - cnt + idx)) {
+				printf("test_meterfs_bench: record %u read %d bytes with sequence %u, expected %zu\n", idx, err, seq, written - cnt + idx);
+				err = -EIO;
+				break;
+			}
+		}
+		if (i < BENCH_SAMPLES)
+			break;
+
+		p50 = bench_pct(bench_common.samples, BENCH_SAMPLES, 50);
+		p99 = bench_percentile(bench_common.samples, BENCH_SAMPLES, 99);
+
+		total = bench_time();
+		for (i = 0; i < BENCH_SAMPLES; i++) {
+			if ((err = file_getInfo(fd, NULL, NULL, NULL, &info)) < 0 || info != cnt) {
+				printf("test_meterfs_bench: getInfo returned %zu records, expected %zu (%d)\n", info, cnt, err);
+				err = -EIO;
+				break;
+			}
+		}
+		total = bench_time() - total;
+		if (i < BENCH_SAMPLES)
+			break;
+
+		printf("test_meterfs_bench: file %zu rec %zu fill %u%%: read p50 %" PRIu64 " p99 %" PRIu64 " us, getInfo %" PRIu64 " ns/op\n",
+			filesz, recordsz, bench_fills[f], p50, p99, total * 1000 / BENCH_SAMPLES);
+		err = 0;
+	}
+
+	file_close(fd);
+	free(bench_common.appends);
+
+	return err;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int i;
+	int err = 0;
+
+	if (argc < 2) {
+		printf("Usage: %s <flash image>\n", argv[0]);
+		return 1;
+	}
+
+	file_init(argv[1]);
+
+	for (i = 0; (i < sizeof(bench_geoms) / sizeof(bench_geoms[0])) && (err >= 0); i++) {
+		if ((err = file_eraseAll()) < 0) {
+			printf("test_meterfs_bench: failed to erase flash (%d)\n", err);
+			break;
+		}
+		err = bench_geom(bench_geoms[i].filesz, bench_geoms[i].recordsz);
+	}
+
+	file_eraseAll();
+	printf("test_meterfs_bench: %s\n", (err < 0) ? "FAILED" : "done");
+
+	return (err < 0) ? 1 : 0;
+}
@@ -0,0 +1,354 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Meterfs concurrent multi-file writers stress test
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "../test_common.h"
+
+#define CONCURRENT_SECTORSZ   4096 /* Flash sector size, as in file_pc.c */
+#define CONCURRENT_FILES      32   /* Files shared out between writer threads */
+#define CONCURRENT_FILESZ     8192
+#define CONCURRENT_SHAREDSZ   65536
+#define CONCURRENT_RECORDSZ   32
+#define CONCURRENT_MAXTHREADS 8
+
+
+static const unsigned int concurrent_threads[] = { 1, 2, 4, 8 };
+
+
+/* Record header, rest of the record is derived from it */
+typedef struct {
+	uint16_t file;
+	uint16_t thread;
+	uint32_t seq;
+} concurrent_hdr_t;
+
+
+typedef struct {
+	pthread_t tid;
+	unsigned int id;
+	unsigned int threads;
+	int shared;
+	int err;
+} concurrent_writer_t;
+
+
+static struct {
+	int fds[CONCURRENT_FILES];
+	int shared;
+	concurrent_writer_t writers[CONCURRENT_MAXTHREADS];
+	uint32_t next[CONCURRENT_MAXTHREADS];
+} concurrent_common;
+
+
+static void concurrent_record(unsigned char *buff, unsigned int file, unsigned int thread, uint32_t seq)
+{
+	concurrent_hdr_t hdr = { .file = file, .thread = thread, .seq = seq };
+	size_t i;
+
+	memcpy(buff, &hdr, sizeof(hdr));
+	for (i = sizeof(hdr); i < CONCURRENT_RECORDSZ; i++)
+		buff[i] = seq * 3 + file * 5 + thread * 7 + i;
+}
+
+
+static size_t concurrent_sectors(size_t filesz)
+{
+	return (filesz / CONCURRENT_RECORDSZ) * (CONCURRENT_RECORDSZ + 32) / CONCURRENT_SECTORSZ + 3;
+}
+
+
+/* Appends to own files round robin, or to the shared file, errors are only recorded as Unity asserts can't be used outside main thread */
+static void *concurrent_writer(void *arg)
+{
+	concurrent_writer_t *writer = arg;
+	unsigned char buff[CONCURRENT_RECORDSZ];
+	unsigned int files = 0, i, f, n;
+	uint32_t seq;
+	int fd;
+
+	if (writer->shared) {
+		n = CONCURRENT_SHAREDSZ / CONCURRENT_RECORDSZ / writer->threads;
+	}
+	else {
+		for (f = writer->id; f < CONCURRENT_FILES; f += writer->threads)
+			files++;
+		n = files * (CONCURRENT_FILESZ / CONCURRENT_RECORDSZ);
+	}
+
+	for (i = 0; i < n; i++) {
+		if (writer->shared) {
+			f = CONCURRENT_FILES;
+			fd = concurrent_common.shared;
+			seq = i;
+		}
+		else {
+			f = writer->id + (i % files) * writer->threads;
+			fd = concurrent_common.fds[f];
+			seq = i / files;
+		}
+
+		concurrent_record(buff, f, writer->id, seq);
+		if (file_write(fd, buff, sizeof(buff)) != sizeof(buff)) {
+			writer->err = -EIO;
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+
+static int concurrent_open(const char *name, size_t filesz)
+{
+	char path[16];
+	int err;
+
+	if ((err = file_allocate(name, concurrent_sectors(filesz), filesz, CONCURRENT_RECORDSZ)) < 0) {
+		printf("test_meterfs_concurrent: failed to allocate %s (%d)\n", name, err);
+		return err;
+	}
+
+	sprintf(path, "/%s", name);
+
+	return file_open(path);
+}
+
+
+/* Every file holds records of its writer in write order */
+static int concurrent_verifyFiles(unsigned int threads)
+{
+	unsigned char buff[CONCURRENT_RECORDSZ], expected[CONCURRENT_RECORDSZ];
+	const size_t records = CONCURRENT_FILESZ / CONCURRENT_RECORDSZ;
+	concurrent_hdr_t hdr;
+	unsigned int f, i;
+	size_t cnt;
+
+	for (f = 0; f < CONCURRENT_FILES; f++) {
+		if ((file_getInfo(concurrent_common.fds[f], NULL, NULL, NULL, &cnt) < 0) || (cnt != records)) {
+			printf("test_meterfs_concurrent: file %u holds %zu records, expected %zu\n", f, cnt, records);
+			return -EIO;
+		}
+
+		for (i = 0; i < records; i++) {
+			if (file_read(concurrent_common.fds[f], i * CONCURRENT_RECORDSZ, buff, sizeof(buff)) != sizeof(buff))
+				return -EIO;
+
+			memcpy(&hdr, buff, sizeof(hdr));
+			concurrent_record(expected, f, f % threads, i);
+			if (memcmp(buff, expected, sizeof(buff)) != 0) {
+				printf("test_meterfs_concurrent: file %u record %u is file %u thread %u sequence %u, expected sequence %u\n",
+					f, i, hdr.file, hdr.thread, hdr.seq, i);
+				return -EIO;
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+/* Shared file holds all records of all writers, each writer's ones in its write order */
+static int concurrent_verifyShared(unsigned int threads)
+{
+	unsigned char buff[CONCURRENT_RECORDSZ], expected[CONCURRENT_RECORDSZ];
+	const size_t records = CONCURRENT_SHAREDSZ / CONCURRENT_RECORDSZ / threads;
+	concurrent_hdr_t hdr;
+	unsigned int i, t;
+	size_t cnt;
+
+	memset(concurrent_common.next, 0, sizeof(concurrent_common.next));
+
+	if ((file_getInfo(concurrent_common.shared, NULL, NULL, NULL, &cnt) < 0) || (cnt != records * threads)) {
+		printf("test_meterfs_concurrent: shared file holds %zu records, expected %zu\n", cnt, records * threads);
+		return -EIO;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		if (file_read(concurrent_common.shared, i * CONCURRENT_RECORDSZ, buff, sizeof(buff)) != sizeof(buff))
+			return -EIO;
+
+		memcpy(&hdr, buff, sizeof(hdr));
+		t = (hdr.thread < threads) ? hdr.thread : 0;
+
+		concurrent_record(expected, CONCURRENT_FILES, t, concurrent_common.next[t]);
+		if (memcmp(buff, expected, sizeof(buff)) != 0) {
+			printf("test_meterfs_concurrent: shared file record %u is file %u thread %u sequence %u, expected thread %u sequence %u\n",
+				i, hdr.file, hdr.thread, hdr.seq, t, concurrent_common.next[t]);
+			return -EIO;
+		}
+		concurrent_common.next[t]++;
+	}
+
+	return 0;
+}
+
+
+/* Runs writers and returns elapsed time in usec */
+static int64_t concurrent_run(unsigned int threads, int shared)
+{
+	concurrent_writer_t *writer;
+	unsigned int i, started;
+	uint64_t t;
+	int err = 0;
+
+	t = bench_time();
+
+	for (started = 0; started < threads; started++) {
+		writer = &concurrent_common.writers[started];
+		writer->id = started;
+		writer->threads = threads;
+		writer->shared = shared;
+		writer->err = 0;
+
+		if (pthread_create(&writer->tid, NULL, concurrent_writer, writer) != 0) {
+			printf("test_meterfs_concurrent: failed to create writer %u\n", started);
+			err = -ENOMEM;
+			break;
+		}
+	}
+
+	for (i = 0; i < started; i++) {
+		pthread_join(concurrent_common.writers[i].tid, NULL);
+		if (concurrent_common.writers[i].err < 0) {
+			printf("test_meterfs_concurrent: writer %u failed (%d)\n", i, concurrent_common.writers[i].err);
+			err = concurrent_common.writers[i].err;
+		}
+	}
+
+	t = bench_time() - t;
+
+	return (err < 0) ? err : (int64_t)t;
+}
+
+
+static int concurrent_test(unsigned int threads, int shared, uint64_t *base)
+{
+	const size_t records = shared ? CONCURRENT_SHAREDSZ / CONCURRENT_RECORDSZ / threads * threads : CONCURRENT_FILES * (CONCURRENT_FILESZ / CONCURRENT_RECORDSZ);
+	char name[16];
+	unsigned int f;
+	int64_t t;
+	int err;
+
+	if ((err = file_eraseAll()) < 0) {
+		printf("test_meterfs_concurrent: failed to erase flash (%d)\n", err);
+		return err;
+	}
+
+	if (shared) {
+		if ((concurrent_common.shared = concurrent_open("shared", CONCURRENT_SHAREDSZ)) < 0)
+			return concurrent_common.shared;
+	}
+	else {
+		for (f = 0; f < CONCURRENT_FILES; f++) {
+			sprintf(name, "conc%u", f);
+			if ((concurrent_common.fds[f] = concurrent_open(name, CONCURRENT_FILESZ)) < 0)
+				return concurrent_common.fds[f];
+		}
+	}
+
+	if ((t = concurrent_run(threads, shared)) < 0)
+		return t;
+
+	err = shared ? concurrent_verifyShared(threads) : concurrent_verifyFiles(threads);
+
+	if (shared) {
+		file_close(concurrent_common.shared);
+	}
+	else {
+		for (f = 0; f < CONCURRENT_FILES; f++)
+			file_close(concurrent_common.fds[f]);
+	}
+
+	if (err < 0)
+		return err;
+
+	t = t ? t : 1;
+	if (threads == 1)
+		*base = t;
+
+	printf("test_meterfs_concurrent: %s, %u threads: %zu records in %" PRIu64 " us, %" PRIu64 " rec/s %" PRIu64 " KB/s, speedup %" PRIu64 ".%02" PRIu64 "x\n",
+		shared ? "1 shared file" : "own files", threads, records, (uint64_t)t, (uint64_t)records * 1000000 / t,
+		(uint64_t)records * CONCURRENT_RECORDSZ * 1000000 / 1024 / t, *base / t, (*base * 100 / t) % 100);
+
+	return 0;
+}
+
+
+TEST_GROUP(meterfs_concurrent);
+
+
+TEST_SETUP(meterfs_concurrent)
+{
+}
+
+
+TEST_TEAR_DOWN(meterfs_concurrent)
+{
+	TEST_ASSERT_EQUAL(0, file_eraseAll());
+}
+
+
+TEST(meterfs_concurrent, own_files)
+{
+	uint64_t base = 1;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(concurrent_threads) / sizeof(concurrent_threads[0]); i++)
+		TEST_ASSERT_EQUAL(0, concurrent_test(concurrent_threads[i], 0, &base));
+}
+
+
+TEST(meterfs_concurrent, shared_file)
+{
+	uint64_t base = 1;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(concurrent_threads) / sizeof(concurrent_threads[0]); i++)
+		TEST_ASSERT_EQUAL(0, concurrent_test(concurrent_threads[i], 1, &base));
+}
+
+
+TEST_GROUP_RUNNER(meterfs_concurrent)
+{
+	RUN_TEST_CASE(meterfs_concurrent, own_files);
+	RUN_TEST_CASE(meterfs_concurrent, shared_file);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(meterfs_concurrent);
+}
+
+
+int main(int argc, char *argv[])
+{
+	file_init(argv[1]);
+	TEST_ASSERT_EQUAL(0, file_eraseAll());
+
+	printf("test_meterfs_concurrent: %u files of %u records, speedup is relative to a single writer\n",
+		CONCURRENT_FILES, CONCURRENT_FILESZ / CONCURRENT_RECORDSZ);
+
+	/* Host flash emulation isn't thread safe, so the file abstraction serializes it and there's no server lock to measure */
+	if (file_serialized())
+		printf("test_meterfs_concurrent: calls are serialized by the test harness, scaling doesn't reflect meterfs server locking\n");
+
+	UnityMain(argc, (const char**)argv, runner);
+
+	return 0;
+}
@@ -0,0 +1,462 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Meterfs power loss simulation and recovery time benchmark
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "file.h"
+#include "../test_common.h"
+
+#define POWERLOSS_SECTORSZ 4096 /* Flash sector size, as in file_pc.c */
+#define POWERLOSS_TRIALS   100  /* Default number of power cut trials */
+#define POWERLOSS_MAXFILES 8    /* Files written in power cut trials */
+#define POWERLOSS_MAXREC   256
+#define POWERLOSS_MOUNTS   5    /* Recovery time samples per benchmark point */
+
+
+/*
+ * Power cut is emulated on the flash image after the cut call returns, as host-flash internals aren't available.
+ * Changed bytes are kept in address order rather than in the order they were programmed, and a byte programmed
+ * twice in one call is cut either before or after both programs. Some resulting images can't occur on real flash,
+ * so recovery mismatches are informational only and don't fail the test, they have to be confirmed on target.
+ * Failures to build the image before the cut are real errors.
+ */
+
+
+/* Power cut trial file geometries */
+static const struct {
+	size_t filesz;
+	size_t recordsz;
+} powerloss_geoms[] = {
+	{ 2048, 16 }, { 4096, 64 }, { 8192, 256 }
+};
+
+
+/* Recovery time benchmark points, files of 4096/32 geometry filled in percent of capacity */
+static const unsigned int powerloss_benchFiles[] = { 1, 8, 32, 128 };
+
+
+static const unsigned int powerloss_benchFills[] = { 0, 50, 100 };
+
+
+/* Written by verifying process */
+typedef struct {
+	uint64_t mount;
+	int kept;
+} powerloss_result_t;
+
+
+/* Flash contents are fully determined by the plan, so the verifying process knows what to expect */
+typedef struct {
+	unsigned int files;
+	size_t filesz;
+	size_t recordsz;
+	unsigned int writes; /* Round robin writes done before the cut one */
+	int resize;          /* Cut during resize of the next file instead of write */
+	int mode;
+	unsigned int seed;
+} powerloss_plan_t;
+
+
+static struct {
+	const char *path;
+	unsigned char buff[POWERLOSS_MAXREC];
+	unsigned char record[POWERLOSS_MAXREC];
+	int fds[POWERLOSS_MAXFILES];
+	powerloss_result_t *result; /* Shared with child processes */
+} powerloss_common;
+
+
+static void powerloss_record(unsigned char *buff, size_t recordsz, unsigned int file, uint32_t seq)
+{
+	size_t i;
+
+	memcpy(buff, &seq, sizeof(seq));
+	for (i = sizeof(seq); i < recordsz; i++)
+		buff[i] = seq + i + file * 7;
+}
+
+
+static size_t powerloss_sectors(size_t filesz, size_t recordsz)
+{
+	return (filesz / recordsz) * (recordsz + 32) / POWERLOSS_SECTORSZ + 3;
+}
+
+
+/* Runs fn in a new process, so every meterfs instance starts from the flash image alone, like after reboot */
+static int powerloss_process(int (*fn)(const void *), const void *arg)
+{
+	int status;
+	pid_t pid;
+
+	fflush(stdout);
+
+	if ((pid = fork()) < 0)
+		return -errno;
+
+	if (pid == 0) {
+		status = fn(arg);
+		fflush(stdout);
+		_exit((status < 0) ? 1 : 0);
+	}
+
+	if ((waitpid(pid, &status, 0) < 0) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+		return -EIO;
+
+	return 0;
+}
+
+
+/* Allocates files, writes planned records round robin and cuts power on the next write or resize */
+static int powerloss_write(const void *arg)
+{
+	const powerloss_plan_t *plan = arg;
+	char name[16];
+	unsigned int i, target = plan->writes % plan->files;
+	int err;
+
+	file_init(powerloss_common.path);
+
+	if ((err = file_eraseAll()) < 0)
+		return err;
+
+	for (i = 0; i < plan->files; i++) {
+		sprintf(name, "pl%u", i);
+		if ((err = file_allocate(name, powerloss_sectors(plan->filesz, plan->recordsz), plan->filesz, plan->recordsz)) < 0)
+			return err;
+
+		sprintf(name, "/pl%u", i);
+		if ((powerloss_common.fds[i] = file_open(name)) < 0)
+			return powerloss_common.fds[i];
+	}
+
+	for (i = 0; i < plan->writes; i++) {
+		powerloss_record(powerloss_common.buff, plan->recordsz, i % plan->files, i / plan->files);
+		if (file_write(powerloss_common.fds[i % plan->files], powerloss_common.buff, plan->recordsz) != (int)plan->recordsz)
+			return -EIO;
+	}
+
+	if ((err = file_powerCut(plan->mode, plan->seed)) < 0) {
+		printf("test_meterfs_powerloss: power cut not available (%d)\n", err);
+		return err;
+	}
+
+	/* Result of the cut call doesn't matter, it never completes on real flash */
+	if (plan->resize) {
+		file_resize(powerloss_common.fds[target], plan->filesz / 2, plan->recordsz);
+	}
+	else {
+		powerloss_record(powerloss_common.buff, plan->recordsz, target, plan->writes / plan->files);
+		file_write(powerloss_common.fds[target], powerloss_common.buff, plan->recordsz);
+	}
+
+	return 0;
+}
+
+
+/* Checks records are consecutive and intact, with the newest one in [minlast, maxlast], returns newest one */
+static int powerloss_checkRecords(int fd, unsigned int file, size_t recordsz, size_t capacity, size_t cnt, int minlast, int maxlast)
+{
+	uint32_t first, seq;
+	unsigned int i;
+	int last;
+
+	if ((cnt == 0) && (minlast < 0))
+		return -1;
+
+	if (cnt == 0) {
+		printf("test_meterfs_powerloss: file %u is empty, expected records up to %d..%d\n", file, minlast, maxlast);
+		return -EIO;
+	}
+
+	if (file_read(fd, 0, powerloss_common.buff, recordsz) != (int)recordsz)
+		return -EIO;
+
+	memcpy(&first, powerloss_common.buff, sizeof(first));
+	last = first + cnt - 1;
+
+	if ((last < minlast) || (last > maxlast) || (cnt != ((last + 1 < (int)capacity) ? last + 1 : capacity))) {
+		printf("test_meterfs_powerloss: file %u holds %zu records up to %d, expected up to %d..%d\n", file, cnt, last, minlast, maxlast);
+		return -EIO;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		powerloss_record(powerloss_common.record, recordsz, file, first + i);
+		if ((file_read(fd, i * recordsz, powerloss_common.buff, recordsz) != (int)recordsz) ||
+			(memcmp(powerloss_common.buff, powerloss_common.record, recordsz) != 0)) {
+			memcpy(&seq, powerloss_common.buff, sizeof(seq));
+			printf("test_meterfs_powerloss: file %u record %u corrupted (sequence %u, expected %u)\n", file, i, seq, first + i);
+			return -EIO;
+		}
+	}
+
+	return last;
+}
+
+
+/* Remounts flash image and verifies every file against the plan, then checks files still take writes */
+static int powerloss_verify(const void *arg)
+{
+	const powerloss_plan_t *plan = arg;
+	size_t filesz, recordsz, cnt;
+	unsigned int i, target = plan->writes % plan->files;
+	int fd, err, last, expected;
+	uint64_t t;
+	char name[16];
+
+	/* Only hostflashsrv_init() is timed, flash image isn't mapped until file_powerCut() */
+	t = bench_time();
+	file_init(powerloss_common.path);
+	powerloss_common.result->mount = bench_time() - t;
+
+	for (i = 0; i < plan->files; i++) {
+		expected = plan->writes / plan->files + (i < target) - 1;
+
+		sprintf(name, "/pl%u", i);
+		if ((fd = file_open(name)) < 0) {
+			printf("test_meterfs_powerloss: file %u lost (%d)\n", i, fd);
+			return -EIO;
+		}
+
+		if ((err = file_getInfo(fd, NULL, &filesz, &recordsz, &cnt)) < 0) {
+			printf("test_meterfs_powerloss: file %u info failed (%d)\n", i, err);
+			return err;
+		}
+
+		if ((i == target) && plan->resize && (filesz == plan->filesz / 2) && (recordsz == plan->recordsz)) {
+			/* Resize made it, old records are dropped */
+			last = powerloss_checkRecords(fd, i, recordsz, filesz / recordsz, cnt, -1, -1);
+			powerloss_common.result->kept = 1;
+		}
+		else if ((filesz == plan->filesz) && (recordsz == plan->recordsz)) {
+			last = powerloss_checkRecords(fd, i, recordsz, filesz / recordsz, cnt, expected,
+				((i == target) && !plan->resize) ? expected + 1 : expected);
+			if (i == target)
+				powerloss_common.result->kept = (last > expected);
+		}
+		else {
+			printf("test_meterfs_powerloss: file %u geometry %zu/%zu, expected %zu/%zu\n", i, filesz, recordsz, plan->filesz, plan->recordsz);
+			last = -EIO;
+		}
+
+		if (last < -1)
+			return last;
+
+		powerloss_record(powerloss_common.record, recordsz, i, last + 1);
+		if ((file_write(fd, powerloss_common.record, recordsz) != (int)recordsz) ||
+			(file_getInfo(fd, NULL, NULL, NULL, &cnt) < 0) || (cnt == 0) ||
+			(file_read(fd, (cnt - 1) * recordsz, powerloss_common.buff, recordsz) != (int)recordsz) ||
+			(memcmp(powerloss_common.buff, powerloss_common.record, recordsz) != 0)) {
+			printf("test_meterfs_powerloss: file %u write after recovery failed\n", i);
+			return -EIO;
+		}
+
+		file_close(fd);
+	}
+
+	return 0;
+}
+
+
+static int powerloss_mount(const void *arg)
+{
+	uint64_t t;
+
+	/* Only hostflashsrv_init() is timed, flash image isn't mapped until file_powerCut() */
+	t = bench_time();
+	file_init(powerloss_common.path);
+	powerloss_common.result->mount = bench_time() - t;
+
+	return 0;
+}
+
+
+/* Allocates files and fills them up to given percent of capacity */
+static int powerloss_fill(const void *arg)
+{
+	const unsigned int *point = arg;
+	size_t capacity = 4096 / 32, records = capacity * point[1] / 100, r;
+	char name[16];
+	unsigned int i;
+	int fd, err;
+
+	file_init(powerloss_common.path);
+
+	if ((err = file_eraseAll()) < 0)
+		return err;
+
+	for (i = 0; i < point[0]; i++) {
+		sprintf(name, "pl%u", i);
+		if ((err = file_allocate(name, powerloss_sectors(4096, 32), 4096, 32)) < 0) {
+			printf("test_meterfs_powerloss: failed to allocate file %u (%d)\n", i, err);
+			return err;
+		}
+
+		sprintf(name, "/pl%u", i);
+		if ((fd = file_open(name)) < 0)
+			return fd;
+
+		for (r = 0; r < records; r++) {
+			powerloss_record(powerloss_common.buff, 32, i, r);
+			if (file_write(fd, powerloss_common.buff, 32) != 32) {
+				file_close(fd);
+				return -EIO;
+			}
+		}
+
+		file_close(fd);
+	}
+
+	return 0;
+}
+
+
+static int powerloss_trials(unsigned int trials, unsigned int seed)
+{
+	static const char *modes[] = { "", "truncated", "corrupted" };
+	unsigned int i, mismatched = 0, writes = 0, kept = 0, resizes = 0, resized = 0, g;
+	powerloss_plan_t plan;
+	uint64_t *mounts;
+
+	if ((mounts = malloc(trials * sizeof(*mounts))) == NULL)
+		return -ENOMEM;
+
+	printf("test_meterfs_powerloss: %u power cut trials, seed = %u\n", trials, seed);
+
+	for (i = 0; i < trials; i++) {
+		g = rand_r(&seed) % (sizeof(powerloss_geoms) / sizeof(powerloss_geoms[0]));
+		plan.files = 1 + rand_r(&seed) % POWERLOSS_MAXFILES;
+		plan.filesz = powerloss_geoms[g].filesz;
+		plan.recordsz = powerloss_geoms[g].recordsz;
+		/* Up to twice the capacity, so cuts land on wrapped files too */
+		plan.writes = rand_r(&seed) % (2 * plan.files * plan.filesz / plan.recordsz + 1);
+		plan.resize = (rand_r(&seed) % 5) == 0;
+		plan.mode = (rand_r(&seed) & 1) ? file_cutCorrupt : file_cutTruncate;
+		plan.seed = rand_r(&seed);
+
+		powerloss_common.result->mount = 0;
+		powerloss_common.result->kept = 0;
+
+		if (powerloss_process(powerloss_write, &plan) < 0) {
+			printf("test_meterfs_powerloss: trial %u failed to write plan\n", i);
+			free(mounts);
+			return -EIO;
+		}
+
+		if (powerloss_process(powerloss_verify, &plan) < 0) {
+			printf("test_meterfs_powerloss: trial %u recovery mismatch (informational): %u files %zu/%zu, %u writes, %s %s\n", i, plan.files,
+				plan.filesz, plan.recordsz, plan.writes, modes[plan.mode], plan.resize ? "resize" : "write");
+			mismatched++;
+			continue;
+		}
+
+		mounts[i - mismatched] = powerloss_common.result->mount;
+		if (plan.resize) {
+			resizes++;
+			resized += powerloss_common.result->kept;
+		}
+		else {
+			writes++;
+			kept += powerloss_common.result->kept;
+		}
+	}
+
+	printf("test_meterfs_powerloss: write cuts %u (record kept %u, dropped %u), resize cuts %u (resized %u, kept old %u), mismatched %u\n",
+		writes, kept, writes - kept, resizes, resized, resizes - resized, mismatched);
+
+	if (mismatched != 0) {
+		printf("test_meterfs_powerloss: note: cuts keep flash changes in address order, not program order, and can't split\n");
+		printf("test_meterfs_powerloss: repeated programs of one byte, so mismatches may come from the harness, confirm on target\n");
+		printf("test_meterfs_powerloss: host power cut results are informational, mismatches don't affect exit status\n");
+	}
+
+	if (trials > mismatched) {
+		qsort(mounts, trials - mismatched, sizeof(*mounts), bench_cmp);
+		printf("test_meterfs_powerloss: recovery p50 %" PRIu64 " p99 %" PRIu64 " max %" PRIu64 " us\n",
+			bench_percentile(mounts, trials - mismatched, 50), bench_percentile(mounts, trials - mismatched, 99), mounts[trials - mismatched - 1]);
+	}
+
+	free(mounts);
+
+	return 0;
+}
+
+
+static int powerloss_bench(void)
+{
+	uint64_t mounts[POWERLOSS_MOUNTS];
+	unsigned int f, p, i, point[2];
+
+	for (f = 0; f < sizeof(powerloss_benchFiles) / sizeof(powerloss_benchFiles[0]); f++) {
+		for (p = 0; p < sizeof(powerloss_benchFills) / sizeof(powerloss_benchFills[0]); p++) {
+			point[0] = powerloss_benchFiles[f];
+			point[1] = powerloss_benchFills[p];
+
+			if (powerloss_process(powerloss_fill, point) < 0) {
+				printf("test_meterfs_powerloss: failed to fill %u files\n", point[0]);
+				return -EIO;
+			}
+
+			for (i = 0; i < POWERLOSS_MOUNTS; i++) {
+				if (powerloss_process(powerloss_mount, NULL) < 0)
+					return -EIO;
+				mounts[i] = powerloss_common.result->mount;
+			}
+
+			qsort(mounts, POWERLOSS_MOUNTS, sizeof(mounts[0]), bench_cmp);
+			printf("test_meterfs_powerloss: %3u files %6u records: mount p50 %" PRIu64 " max %" PRIu64 " us\n",
+				point[0], point[0] * (4096 / 32) * point[1] / 100, bench_percentile(mounts, POWERLOSS_MOUNTS, 50), mounts[POWERLOSS_MOUNTS - 1]);
+		}
+	}
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int trials = POWERLOSS_TRIALS, seed = time(NULL);
+	int err;
+
+	if (argc < 2) {
+		printf("Usage: %s <flash image> [trials] [seed]\n", argv[0]);
+		return 1;
+	}
+
+	powerloss_common.path = argv[1];
+
+	if (argc > 2)
+		trials = strtoul(argv[2], NULL, 10);
+
+	if (argc > 3)
+		seed = strtoul(argv[3], NULL, 10);
+
+	powerloss_common.result = mmap(NULL, sizeof(powerloss_result_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (powerloss_common.result == MAP_FAILED) {
+		printf("test_meterfs_powerloss: failed to map results\n");
+		return 1;
+	}
+
+	if ((err = powerloss_trials(trials, seed)) == 0)
+		err = powerloss_bench();
+
+	munmap(powerloss_common.result, sizeof(powerloss_result_t));
+	printf("test_meterfs_powerloss: %s\n", (err < 0) ? "FAILED" : "done");
+
+	return (err < 0) ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Meterfs flash wear workload
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file.h"
+
+#define WEAR_SECTORSZ 4096 /* Flash sector size, as in file_pc.c */
+#define WEAR_SECTORS  1024 /* Flash sectors, as in file_pc.c */
+#define WEAR_ROUNDS   20   /* Default number of times whole file capacity is rewritten */
+#define WEAR_MAXREC   1024
+#define WEAR_HISTSZ   12   /* Erase distribution entries printed */
+
+
+/* Workload file geometries, spare is number of sectors above the minimum needed */
+static const struct {
+	size_t filesz;
+	size_t recordsz;
+	size_t spare;
+} wear_geoms[] = {
+	{ 4096, 16, 3 }, { 4096, 256, 3 }, { 65536, 16, 3 }, { 65536, 256, 3 }, { 65536, 256, 16 }, { 262144, 1024, 3 }
+};
+
+
+static struct {
+	unsigned char buff[WEAR_MAXREC];
+	unsigned int erases[WEAR_SECTORS];
+	size_t programmed[WEAR_SECTORS];
+} wear_common;
+
+
+static void wear_record(unsigned char *buff, size_t recordsz, uint32_t seq)
+{
+	size_t i;
+
+	memcpy(buff, &seq, sizeof(seq));
+	for (i = sizeof(seq); i < recordsz; i++)
+		buff[i] = seq + i;
+}
+
+
+static int wear_cmp(const void *a, const void *b)
+{
+	unsigned int x = *(const unsigned int *)a, y = *(const unsigned int *)b;
+
+	return (x > y) - (x < y);
+}
+
+
+/* Prints erase count distribution over sectors touched by workload */
+static void wear_report(size_t filesz, size_t recordsz, size_t sectors, uint64_t user)
+{
+	uint64_t programmed = 0, erases = 0;
+	unsigned int i, j, n = 0, k;
+	char hist[WEAR_HISTSZ * 24], *p = hist;
+
+	for (i = 0; i < WEAR_SECTORS; i++) {
+		if ((wear_common.erases[i] == 0) && (wear_common.programmed[i] == 0))
+			continue;
+
+		programmed += wear_common.programmed[i];
+		erases += wear_common.erases[i];
+		wear_common.erases[n++] = wear_common.erases[i];
+	}
+
+	user = user ? user : 1;
+	printf("test_meterfs_wear: file %zu rec %zu sectors %zu: %" PRIu64 " KB written, %" PRIu64 " KB programmed (WA %" PRIu64 ".%02" PRIu64 "), %" PRIu64 " erases (%" PRIu64 " erased bytes per written KB)\n",
+		filesz, recordsz, sectors, user / 1024, programmed / 1024, programmed / user, (programmed * 100 / user) % 100,
+		erases, erases * WEAR_SECTORSZ * 1024 / user);
+
+	if (n == 0)
+		return;
+
+	qsort(wear_common.erases, n, sizeof(wear_common.erases[0]), wear_cmp);
+
+	/* Distinct erase counts with number of sectors each */
+	hist[0] = '\0';
+	for (i = 0, k = 0; (i < n) && (k < WEAR_HISTSZ); k++) {
+		for (j = i; (j < n) && (wear_common.erases[j] == wear_common.erases[i]); j++)
+			;
+		p += sprintf(p, " %u:%u", wear_common.erases[i], j - i);
+		i = j;
+	}
+
+	printf("test_meterfs_wear: file %zu rec %zu sectors %zu: %u sectors touched, erases min %u avg %" PRIu64 ".%02" PRIu64 " max %u, erases:sectors%s%s\n",
+		filesz, recordsz, sectors, n, wear_common.erases[0], erases / n, (erases * 100 / n) % 100, wear_common.erases[n - 1], hist, (i < n) ? " ..." : "");
+}
+
+
+static int wear_geom(size_t filesz, size_t recordsz, size_t spare, unsigned int rounds)
+{
+	size_t records = filesz / recordsz * rounds, sectors = (filesz / recordsz) * (recordsz + 32) / WEAR_SECTORSZ + spare, i;
+	int fd, err;
+
+	if (((err = file_allocate("wear", sectors, filesz, recordsz)) < 0) || ((err = file_open("/wear")) < 0)) {
+		printf("test_meterfs_wear: failed to create %zu sector file %zu/%zu (%d)\n", sectors, filesz, recordsz, err);
+		return err;
+	}
+	fd = err;
+
+	/* Only appends are accounted, not the file allocation */
+	file_wearReset();
+
+	for (i = 0; i < records; i++) {
+		wear_record(wear_common.buff, recordsz, i);
+		if ((err = file_write(fd, wear_common.buff, recordsz)) != (int)recordsz) {
+			printf("test_meterfs_wear: write of record %zu failed (%d)\n", i, err);
+			file_close(fd);
+			return -EIO;
+		}
+	}
+
+	file_close(fd);
+
+	if ((err = file_wearGet(wear_common.erases, wear_common.programmed, WEAR_SECTORS)) < 0) {
+		printf("test_meterfs_wear: flash wear counters not available (%d)\n", err);
+		return err;
+	}
+
+	wear_report(filesz, recordsz, sectors, (uint64_t)records * recordsz);
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int i, rounds = WEAR_ROUNDS;
+	int err = 0;
+
+	if (argc < 2) {
+		printf("Usage: %s <flash image> [rounds]\n", argv[0]);
+		return 1;
+	}
+
+	if (argc > 2)
+		rounds = strtoul(argv[2], NULL, 10);
+
+	file_init(argv[1]);
+
+	printf("test_meterfs_wear: rewriting each file %u times\n", rounds);
+
+	for (i = 0; (i < sizeof(wear_geoms) / sizeof(wear_geoms[0])) && (err >= 0); i++) {
+		if ((err = file_eraseAll()) < 0) {
+			printf("test_meterfs_wear: failed to erase flash (%d)\n", err);
+			break;
+		}
+		err = wear_geom(wear_geoms[i].filesz, wear_geoms[i].recordsz, wear_geoms[i].spare, rounds);
+	}
+
+	file_eraseAll();
+	printf("test_meterfs_wear: %s\n", (err < 0) ? "FAILED" : "done");
+
+	return (err < 0) ? 1 : 0;
+}
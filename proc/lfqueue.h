@@ -0,0 +1,183 @@
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/lfqueue
+ *
+ * Bounded lock-free queues
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef LFQUEUE_H
+#define LFQUEUE_H
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+
+#define LFQ_CACHELINE 64
+
+
+/*
+ * Single producer, single consumer ring. Head is written only by consumer,
+ * tail only by producer, so each side needs just one acquire/release pair.
+ */
+
+typedef struct {
+	atomic_uint head __attribute__((aligned(LFQ_CACHELINE)));
+	atomic_uint tail __attribute__((aligned(LFQ_CACHELINE)));
+	unsigned int mask __attribute__((aligned(LFQ_CACHELINE)));
+	void **buf;
+} lfq_spsc_t;
+
+
+/* size has to be a power of 2 */
+static inline int lfq_spsc_init(lfq_spsc_t *q, void **buf, unsigned int size)
+{
+	if (size == 0 || (size & (size - 1)) != 0)
+		return -EINVAL;
+
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	q->mask = size - 1;
+	q->buf = buf;
+
+	return EOK;
+}
+
+
+static inline int lfq_spsc_push(lfq_spsc_t *q, void *data)
+{
+	unsigned int tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+	if (tail - atomic_load_explicit(&q->head, memory_order_acquire) > q->mask)
+		return -EAGAIN;
+
+	q->buf[tail & q->mask] = data;
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+
+	return EOK;
+}
+
+
+static inline int lfq_spsc_pop(lfq_spsc_t *q, void **data)
+{
+	unsigned int head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+	if (head == atomic_load_explicit(&q->tail, memory_order_acquire))
+		return -EAGAIN;
+
+	*data = q->buf[head & q->mask];
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+
+	return EOK;
+}
+
+
+/*
+ * Multiple producer, multiple consumer ring (D. Vyukov's bounded queue).
+ * Each cell carries a sequence number telling whether it is ready to be
+ * written (seq == pos) or read (seq == pos + 1) at given position.
+ */
+
+typedef struct {
+	atomic_uint seq;
+	void *data;
+} lfq_cell_t;
+
+
+typedef struct {
+	atomic_uint head __attribute__((aligned(LFQ_CACHELINE)));
+	atomic_uint tail __attribute__((aligned(LFQ_CACHELINE)));
+	unsigned int mask __attribute__((aligned(LFQ_CACHELINE)));
+	lfq_cell_t *cells;
+} lfq_mpmc_t;
+
+
+/* size has to be a power of 2, single cell can't tell full from empty */
+static inline int lfq_mpmc_init(lfq_mpmc_t *q, lfq_cell_t *cells, unsigned int size)
+{
+	unsigned int i;
+
+	if (size < 2 || (size & (size - 1)) != 0)
+		return -EINVAL;
+
+	for (i = 0; i < size; i++)
+		atomic_init(&cells[i].seq, i);
+
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	q->mask = size - 1;
+	q->cells = cells;
+
+	return EOK;
+}
+
+
+static inline int lfq_mpmc_push(lfq_mpmc_t *q, void *data)
+{
+	unsigned int pos = atomic_load_explicit(&q->tail, memory_order_relaxed), seq;
+	lfq_cell_t *cell;
+	int diff;
+
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		diff = (int)(seq - pos);
+
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&q->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0) {
+			return -EAGAIN;
+		}
+		else {
+			pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+		}
+	}
+
+	cell->data = data;
+	atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+
+	return EOK;
+}
+
+
+static inline int lfq_mpmc_pop(lfq_mpmc_t *q, void **data)
+{
+	unsigned int pos = atomic_load_explicit(&q->head, memory_order_relaxed), seq;
+	lfq_cell_t *cell;
+	int diff;
+
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		diff = (int)(seq - (pos + 1));
+
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0) {
+			return -EAGAIN;
+		}
+		else {
+			pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+		}
+	}
+
+	*data = cell->data;
+	atomic_store_explicit(&cell->seq, pos + q->mask + 1, memory_order_release);
+
+	return EOK;
+}
+
+#endif
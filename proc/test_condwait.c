@@ -20,6 +20,23 @@
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include <sys/minmax.h>
+
+#include "../test_common.h"
+
+#define SWEEP_REPS    200     /* Default repetitions per timeout */
+#define SWEEP_MAXTIME 2000000 /* Max time spent on one timeout [us] */
+#define SWEEP_MINREPS 5       /* Repetitions of timeouts longer than SWEEP_MAXTIME / reps */
+#define SWEEP_BUSY    2       /* Number of busy threads in load phase */
+#define SWEEP_STACKSZ 2048
+#define SWEEP_PRIO    4
+
+
+static struct {
+	volatile int stop;
+	char stacks[SWEEP_BUSY][SWEEP_STACKSZ] __attribute__((aligned(8)));
+} test_condwait_common;
+
 
 int test_condwait(void)
 {
@@ -42,10 +59,99 @@ int test_condwait(void)
 }
 
 
-int main(void)
+static void test_condwait_busythr(void *arg)
+{
+	while (!test_condwait_common.stop);
+	endthread();
+}
+
+
+/* Measures how late condWait returns with -ETIME for timeouts from 1 us to 1 s */
+static int test_condwait_sweep(const char *phase, handle_t m, handle_t c, unsigned int reps)
+{
+	time_t timeout, now, then;
+	unsigned int i, n, failed = 0;
+	uint64_t *samples;
+	char name[64];
+	int err;
+
+	if ((samples = malloc(reps * sizeof(*samples))) == NULL)
+		return -1;
+
+	for (timeout = 1; timeout <= 1000000; timeout *= 10) {
+		n = (timeout * reps > SWEEP_MAXTIME) ? SWEEP_MAXTIME / timeout : reps;
+		n = (n > SWEEP_MINREPS) ? n : min(SWEEP_MINREPS, reps);
+
+		mutexLock(m);
+		for (i = 0; i < n; i++) {
+			gettime(&then, NULL);
+			err = condWait(c, m, timeout);
+			gettime(&now, NULL);
+
+			if (err != -ETIME || now - then < timeout) {
+				printf("test_condwait/%s: timeout %llu ret %d elapsed %llu [us]\n", phase, (unsigned long long)timeout, err, (unsigned long long)(now - then));
+				failed++;
+			}
+
+			samples[i] = (now - then > timeout) ? now - then - timeout : 0;
+		}
+		mutexUnlock(m);
+
+		snprintf(name, sizeof(name), "test_condwait/%s %llu us overshoot", phase, (unsigned long long)timeout);
+		bench_print(name, samples, n);
+		bench_histogram(name, samples, n);
+	}
+
+	free(samples);
+
+	return failed ? -1 : 0;
+}
+
+
+int test_condwait_accuracy(unsigned int reps)
 {
+	handle_t m, c;
+	int i, res = 0;
+
+	if (mutexCreate(&m) != EOK || condCreate(&c) != EOK)
+		return -1;
+
+	priority(SWEEP_PRIO);
+
+	if (test_condwait_sweep("idle", m, c, reps) < 0)
+		res = -1;
+
+	/* Busy threads share main thread priority so the timer wakeup has to preempt them */
+	test_condwait_common.stop = 0;
+	for (i = 0; i < SWEEP_BUSY; i++) {
+		if (beginthread(test_condwait_busythr, SWEEP_PRIO, test_condwait_common.stacks[i], SWEEP_STACKSZ, NULL) < 0) {
+			printf("test_condwait: failed to start busy thread\n");
+			test_condwait_common.stop = 1;
+			return -1;
+		}
+	}
+
+	if (test_condwait_sweep("busy", m, c, reps) < 0)
+		res = -1;
+
+	test_condwait_common.stop = 1;
+
+	return res;
+}
+
+
+int main(int argc, char *argv[])
+{
+	int res;
+
+	if (argc > 1 && strcmp(argv[1], "-s") == 0) {
+		res = test_condwait_accuracy((argc > 2 && atoi(argv[2]) > 0) ? atoi(argv[2]) : SWEEP_REPS);
+		printf("condwait: accuracy %s\n", res == 0 ? "PASSED" : "FAILED");
+		return res == 0 ? 0 : 1;
+	}
+
 	printf("test_condwait: Starting, main is at %p\n", main);
-	int res = test_condwait();
+	res = test_condwait();
 
 	printf("condwait: %s\n", res == 0 ? "PASSED" : "FAILED");
 
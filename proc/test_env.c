@@ -18,6 +18,10 @@
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+
+#include "../test_common.h"
 
 #define NUM_OF_VARIABLES        (64)
 #define NUM_OF_TESTS            (1000)
@@ -27,6 +31,9 @@
 /* Defines how often environment should be cleared (approximately) */
 #define CLEARENV_APPROX_EVERY   (200)
 
+#define BENCH_COUNT             (200)
+#define BENCH_HELLO             ("/bin/test-helloworld")
+
 typedef struct {
 	char name[MAX_NAME_LEN];
 	char value[MAX_VALUE_LEN];
@@ -39,11 +46,19 @@ static env_var_t vars[NUM_OF_VARIABLES];
 static int test_env_random(void);
 static int test_env_exec_start(char *path);
 static int test_env_exec_continue(void);
+static int test_env_bench(char *self, char *hello);
 
 int main(int argc, char *argv[])
 {
 	int res;
 
+	/* Process lifecycle benchmark, exec target exits immediately */
+	if (argc >= 2 && strcmp(argv[1], "-n") == 0)
+		return 0;
+
+	if (argc >= 2 && strcmp(argv[1], "-b") == 0)
+		return test_env_bench(argv[0], argc > 2 ? argv[2] : BENCH_HELLO) == 0 ? 0 : 1;
+
 	if (argc == 2 && strcmp(argv[1], "-e") == 0) {
 		res = test_env_exec_continue();
 		printf("test_env: exec test: %s\n", res == 0 ? "PASSED" : "FAILED");
@@ -199,3 +214,114 @@ static int test_env_exec_continue(void)
 
 	return 0;
 }
+
+enum { bench_fork_exit, bench_fork_exec, bench_vfork_exec };
+
+static void test_env_bench_child(char *path)
+{
+	char *argv[3];
+	int fd;
+
+	/* Keep spawned binaries quiet */
+	if ((fd = open("/dev/null", O_WRONLY)) >= 0) {
+		dup2(fd, STDOUT_FILENO);
+		close(fd);
+	}
+
+	argv[0] = path;
+	argv[1] = "-n";
+	argv[2] = NULL;
+
+	execve(path, argv, environ);
+	_exit(127);
+}
+
+static int test_env_bench_spawn(int mode, char *path)
+{
+	int pid, status;
+
+	if (mode == bench_vfork_exec)
+		pid = vfork();
+	else
+		pid = fork();
+
+	if (pid < 0)
+		return -1;
+
+	if (pid == 0) {
+		if (mode == bench_fork_exit)
+			_exit(0);
+		test_env_bench_child(path);
+	}
+
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		return -1;
+
+	return 0;
+}
+
+static int test_env_bench_run(const char *name, int mode, char *path, uint64_t *samples)
+{
+	unsigned i;
+	uint64_t t;
+
+	fflush(stdout);
+
+	for (i = 0; i < BENCH_COUNT; i++) {
+		t = bench_time();
+		if (test_env_bench_spawn(mode, path) != 0) {
+			printf("test_env: %s %s failed\n", name, path);
+			return -1;
+		}
+		samples[i] = bench_time() - t;
+	}
+
+	bench_print(name, samples, BENCH_COUNT);
+
+	return 0;
+}
+
+static int test_env_bench(char *self, char *hello)
+{
+	static const unsigned envsz[] = { 0, 8, 16, 32, 64 };
+	uint64_t samples[BENCH_COUNT];
+	unsigned i, j, bytes;
+	char name[64];
+	int res = 0;
+
+	printf("test_env: process lifecycle benchmark, %u spawns per test\n", BENCH_COUNT);
+
+	res |= test_env_bench_run("test_env/fork+exit+wait", bench_fork_exit, NULL, samples);
+	res |= test_env_bench_run("test_env/fork+exec+wait", bench_fork_exec, self, samples);
+	res |= test_env_bench_run("test_env/vfork+exec+wait", bench_vfork_exec, self, samples);
+
+	if (access(hello, X_OK) == 0)
+		res |= test_env_bench_run("test_env/vfork+exec+wait hello", bench_vfork_exec, hello, samples);
+	else
+		printf("test_env: %s not found, skipping\n", hello);
+
+	/* Environment of NUM_OF_VARIABLES variables set up like in random test, values of maximal length */
+	for (i = 0; i < NUM_OF_VARIABLES; i++) {
+		sprintf(vars[i].name, "VARIABLE%u", i);
+		memset(vars[i].value, 'x', MAX_VALUE_LEN - 1);
+		vars[i].value[MAX_VALUE_LEN - 1] = '\0';
+	}
+
+	for (i = 0; i < sizeof(envsz) / sizeof(envsz[0]); i++) {
+		clearenv();
+		for (j = 0; j < envsz[i]; j++) {
+			if (setenv(vars[j].name, vars[j].value, 1) != 0) {
+				printf("test_env: setenv(%s) failed\n", vars[j].name);
+				return -1;
+			}
+		}
+
+		for (j = 0, bytes = 0; environ != NULL && environ[j] != NULL; j++)
+			bytes += strlen(environ[j]) + 1;
+
+		sprintf(name, "test_env/vfork+exec+wait env %u vars %u bytes", envsz[i], bytes);
+		res |= test_env_bench_run(name, bench_vfork_exec, self, samples);
+	}
+
+	return res;
+}
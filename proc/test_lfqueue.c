@@ -0,0 +1,354 @@
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/test_lfqueue
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/threads.h>
+#include <sys/minmax.h>
+
+#include "lfqueue.h"
+#include "../test_common.h"
+
+#define TEST_LFQ_MAXTHR  4
+#define TEST_LFQ_MAXSZ   256
+#define TEST_LFQ_ROUNDS  30     /* Randomized stress rounds */
+#define TEST_LFQ_ITEMS   10000  /* Items per producer in stress round */
+#define TEST_LFQ_BENCH   200000 /* Items per benchmark run */
+#define TEST_LFQ_BENCHSZ 64
+#define TEST_LFQ_SPINS   8      /* Retries before sleeping on full/empty lock-free queue */
+
+/* Item encodes producer id and its sequence number, never NULL */
+#define TEST_LFQ_ITEM(id, seq) ((void *)(uintptr_t)(((id) << 24) | (seq)))
+#define TEST_LFQ_ID(item)      ((unsigned int)((uintptr_t)(item) >> 24))
+#define TEST_LFQ_SEQ(item)     ((unsigned int)((uintptr_t)(item) & 0xffffff))
+
+
+enum { test_lfq_spsc = 0, test_lfq_mpmc, test_lfq_mutex };
+
+
+static const char *test_lfq_names[] = { "spsc", "mpmc", "mutex" };
+
+
+static struct {
+	lfq_spsc_t spsc;
+	lfq_mpmc_t mpmc;
+	void *buf[TEST_LFQ_MAXSZ];
+	lfq_cell_t cells[TEST_LFQ_MAXSZ];
+
+	/* Reference mutex+condvar queue */
+	handle_t m;
+	handle_t notempty;
+	handle_t notfull;
+	unsigned int head;
+	unsigned int count;
+	unsigned int size;
+
+	int kind;
+	int stress;
+	unsigned int items;
+
+	struct {
+		unsigned int seed;
+		unsigned int count;
+		uint64_t sum;
+		int err;
+	} threads[TEST_LFQ_MAXTHR];
+} test_lfq_common;
+
+
+static void test_lfq_delay(unsigned int *seed)
+{
+	volatile unsigned int k;
+
+	if (rand_r(seed) % 8 == 0) {
+		for (k = rand_r(seed) % 256; k > 0; k--)
+			;
+	}
+}
+
+
+static void test_lfq_backoff(unsigned int *spins)
+{
+	if (++(*spins) >= TEST_LFQ_SPINS) {
+		usleep(1);
+		*spins = 0;
+	}
+}
+
+
+static void test_lfq_push(void *item)
+{
+	unsigned int spins = 0;
+
+	switch (test_lfq_common.kind) {
+		case test_lfq_spsc:
+			while (lfq_spsc_push(&test_lfq_common.spsc, item) < 0)
+				test_lfq_backoff(&spins);
+			break;
+
+		case test_lfq_mpmc:
+			while (lfq_mpmc_push(&test_lfq_common.mpmc, item) < 0)
+				test_lfq_backoff(&spins);
+			break;
+
+		default:
+			mutexLock(test_lfq_common.m);
+			while (test_lfq_common.count == test_lfq_common.size)
+				condWait(test_lfq_common.notfull, test_lfq_common.m, 0);
+			test_lfq_common.buf[(test_lfq_common.head + test_lfq_common.count++) % test_lfq_common.size] = item;
+			condSignal(test_lfq_common.notempty);
+			mutexUnlock(test_lfq_common.m);
+			break;
+	}
+}
+
+
+static void *test_lfq_pop(void)
+{
+	unsigned int spins = 0;
+	void *item;
+
+	switch (test_lfq_common.kind) {
+		case test_lfq_spsc:
+			while (lfq_spsc_pop(&test_lfq_common.spsc, &item) < 0)
+				test_lfq_backoff(&spins);
+			break;
+
+		case test_lfq_mpmc:
+			while (lfq_mpmc_pop(&test_lfq_common.mpmc, &item) < 0)
+				test_lfq_backoff(&spins);
+			break;
+
+		default:
+			mutexLock(test_lfq_common.m);
+			while (test_lfq_common.count == 0)
+				condWait(test_lfq_common.notempty, test_lfq_common.m, 0);
+			item = test_lfq_common.buf[test_lfq_common.head];
+			test_lfq_common.head = (test_lfq_common.head + 1) % test_lfq_common.size;
+			test_lfq_common.count--;
+			condSignal(test_lfq_common.notfull);
+			mutexUnlock(test_lfq_common.m);
+			break;
+	}
+
+	return item;
+}
+
+
+static void *test_lfq_producer(void *arg)
+{
+	unsigned int id = (unsigned int)(long)arg, seq;
+	unsigned int *seed = &test_lfq_common.threads[id].seed;
+
+	for (seq = 1; seq <= test_lfq_common.items; seq++) {
+		test_lfq_push(TEST_LFQ_ITEM(id, seq));
+
+		if (test_lfq_common.stress)
+			test_lfq_delay(seed);
+	}
+
+	return NULL;
+}
+
+
+/* Checks that items of each producer arrive in order, until NULL terminator */
+static void *test_lfq_consumer(void *arg)
+{
+	unsigned int id = (unsigned int)(long)arg, last[TEST_LFQ_MAXTHR] = { 0 }, src, seq;
+	unsigned int *seed = &test_lfq_common.threads[id].seed;
+	void *item;
+
+	while ((item = test_lfq_pop()) != NULL) {
+		src = TEST_LFQ_ID(item);
+		seq = TEST_LFQ_SEQ(item);
+
+		if (src >= TEST_LFQ_MAXTHR || seq <= last[src]) {
+			if (!test_lfq_common.threads[id].err)
+				printf("test_lfqueue: consumer %u got item %u:%u after %u\n", id, src, seq, (src < TEST_LFQ_MAXTHR) ? last[src] : 0);
+			test_lfq_common.threads[id].err = 1;
+			continue;
+		}
+
+		last[src] = seq;
+		test_lfq_common.threads[id].count++;
+		test_lfq_common.threads[id].sum += seq;
+
+		if (test_lfq_common.stress)
+			test_lfq_delay(seed);
+	}
+
+	return NULL;
+}
+
+
+static int test_lfq_init(int kind, unsigned int size)
+{
+	test_lfq_common.kind = kind;
+	test_lfq_common.head = 0;
+	test_lfq_common.count = 0;
+	test_lfq_common.size = size;
+
+	switch (kind) {
+		case test_lfq_spsc:
+			return lfq_spsc_init(&test_lfq_common.spsc, test_lfq_common.buf, size);
+
+		case test_lfq_mpmc:
+			return lfq_mpmc_init(&test_lfq_common.mpmc, test_lfq_common.cells, size);
+
+		default:
+			return (size != 0) ? EOK : -EINVAL;
+	}
+}
+
+
+/* Returns run time in usec or -1 on error */
+static int64_t test_lfq_run(int kind, unsigned int size, unsigned int nprod, unsigned int ncons, unsigned int items)
+{
+	pthread_t prod[TEST_LFQ_MAXTHR], cons[TEST_LFQ_MAXTHR];
+	unsigned int i, count = 0;
+	uint64_t sum = 0, t;
+	int err = 0;
+
+	if (test_lfq_init(kind, size) < 0) {
+		printf("test_lfqueue: failed to init %s queue of size %u\n", test_lfq_names[kind], size);
+		return -1;
+	}
+
+	test_lfq_common.items = items;
+	for (i = 0; i < TEST_LFQ_MAXTHR; i++) {
+		test_lfq_common.threads[i].count = 0;
+		test_lfq_common.threads[i].sum = 0;
+		test_lfq_common.threads[i].err = 0;
+	}
+
+	t = bench_time();
+
+	for (i = 0; i < ncons; i++) {
+		if (pthread_create(&cons[i], NULL, test_lfq_consumer, (void *)(long)i) != EOK) {
+			/* Consumers already running would never get the terminator */
+			printf("test_lfqueue: failed to create consumer\n");
+			exit(1);
+		}
+	}
+
+	for (i = 0; i < nprod; i++) {
+		if (pthread_create(&prod[i], NULL, test_lfq_producer, (void *)(long)i) != EOK) {
+			printf("test_lfqueue: failed to create producer\n");
+			exit(1);
+		}
+	}
+
+	for (i = 0; i < nprod; i++)
+		pthread_join(prod[i], NULL);
+
+	for (i = 0; i < ncons; i++)
+		test_lfq_push(NULL);
+
+	for (i = 0; i < ncons; i++)
+		pthread_join(cons[i], NULL);
+
+	t = bench_time() - t;
+
+	for (i = 0; i < ncons; i++) {
+		count += test_lfq_common.threads[i].count;
+		sum += test_lfq_common.threads[i].sum;
+		err |= test_lfq_common.threads[i].err;
+	}
+
+	if (err || count != nprod * items || sum != (uint64_t)nprod * items * (items + 1) / 2) {
+		printf("test_lfqueue: %s size %u %u:%u lost or reordered items, got %u of %u\n",
+			test_lfq_names[kind], size, nprod, ncons, count, nprod * items);
+		return -1;
+	}
+
+	return t;
+}
+
+
+static int test_lfq_stressrun(unsigned int seed)
+{
+	unsigned int round, size, nprod, ncons, i;
+	int kind, failed = 0;
+
+	printf("test_lfqueue: stress test, seed = %u\n", seed);
+
+	test_lfq_common.stress = 1;
+
+	for (round = 0; round < TEST_LFQ_ROUNDS; round++) {
+		kind = round % 3;
+		size = 2u << (rand_r(&seed) % 8);
+		nprod = ncons = 1;
+
+		if (kind != test_lfq_spsc) {
+			nprod = 1 + rand_r(&seed) % TEST_LFQ_MAXTHR;
+			ncons = 1 + rand_r(&seed) % TEST_LFQ_MAXTHR;
+		}
+
+		for (i = 0; i < TEST_LFQ_MAXTHR; i++)
+			test_lfq_common.threads[i].seed = rand_r(&seed);
+
+		printf("test_lfqueue: round %u %s size %u producers %u consumers %u\n", round, test_lfq_names[kind], size, nprod, ncons);
+
+		if (test_lfq_run(kind, size, nprod, ncons, TEST_LFQ_ITEMS) < 0)
+			failed++;
+	}
+
+	printf("test_lfqueue: %s\n", failed ? "FAILED" : "PASSED");
+
+	return failed ? 1 : 0;
+}
+
+
+static int test_lfq_bench(void)
+{
+	unsigned int n;
+	int64_t t;
+	int kind;
+
+	printf("test_lfqueue: throughput, queue size %u, %u items\n", TEST_LFQ_BENCHSZ, TEST_LFQ_BENCH);
+
+	test_lfq_common.stress = 0;
+
+	for (n = 1; n <= TEST_LFQ_MAXTHR; n *= 2) {
+		for (kind = (n == 1) ? test_lfq_spsc : test_lfq_mpmc; kind <= test_lfq_mutex; kind++) {
+			if ((t = test_lfq_run(kind, TEST_LFQ_BENCHSZ, n, n, TEST_LFQ_BENCH / n)) < 0)
+				return 1;
+
+			printf("test_lfqueue/%s %u:%u: %" PRIu64 " items/s\n", test_lfq_names[kind], n, n,
+				(uint64_t)(TEST_LFQ_BENCH / n) * n * 1000000 / max(t, 1));
+		}
+	}
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	if (mutexCreate(&test_lfq_common.m) < 0 || condCreate(&test_lfq_common.notempty) < 0 || condCreate(&test_lfq_common.notfull) < 0) {
+		printf("test_lfqueue: failed to create mutex queue\n");
+		return 1;
+	}
+
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		return test_lfq_bench();
+
+	return test_lfq_stressrun((argc > 1) ? strtoul(argv[1], NULL, 10) : (unsigned int)time(NULL));
+}
@@ -13,6 +13,7 @@
  * %LICENSE%
  */
 
+#include "errno.h"
 #include "stdio.h"
 #include "stdlib.h"
 #include "unistd.h"
@@ -20,6 +21,60 @@
 #include "sys/mman.h"
 #include "sys/threads.h"
 #include "sys/msg.h"
+#include "sys/minmax.h"
+
+#include "../test_common.h"
+
+#define TEST_MSG_MAXSZ    (64 * 1024) /* Max message size in benchmark mode */
+#define TEST_MSG_MAXTHR   32          /* Max clients/receivers in scaling mode */
+#define TEST_MSG_SCALESZ  32          /* Message size in scaling mode */
+#define TEST_MSG_MINMAP   _PAGE_SIZE  /* Map/copy mode payload sizes */
+#define TEST_MSG_MAXMAP   (16 << 20)
+#define TEST_MSG_MINCOPY  64               /* Copied message sizes in map/copy mode */
+#define TEST_MSG_CHUNK    (_PAGE_SIZE / 2)
+#define TEST_MSG_MAPBYTES (64 << 20)  /* Bytes transferred per message size and mode */
+#define TEST_MSG_MAPMSGS  4096        /* Max messages per message size and mode */
+#define TEST_MSG_MAXBATCH 256         /* Max sub-requests per batched message */
+#define TEST_MSG_STACKSZ  8192
+#define TEST_MSG_PRIO     4
+
+
+/* Message types, 0 (echo) is used by ping */
+enum { test_msg_echo = 0, test_msg_map = 0x1000, test_msg_copy, test_msg_batch };
+
+
+/* Batched message carries an array of sub-requests in i.data, responses are returned in o.data */
+typedef struct {
+	uint32_t seq;
+	uint32_t arg;
+} test_msg_req_t;
+
+
+typedef struct {
+	unsigned phase;
+	unsigned char buf[2][TEST_MSG_SCALESZ];
+	test_msg_req_t req[TEST_MSG_MAXBATCH];
+	uint32_t resp[TEST_MSG_MAXBATCH];
+	volatile unsigned count;
+	int err;
+} test_msg_client_t;
+
+
+static struct {
+	handle_t m;
+	handle_t c;
+	unsigned port;
+
+	/* Scaling and batch modes phase control */
+	unsigned phase;
+	unsigned nclients;
+	unsigned batch;
+	unsigned done;
+	volatile int stop;
+
+	test_msg_client_t clients[TEST_MSG_MAXTHR];
+	volatile unsigned received[TEST_MSG_MAXTHR];
+} test_msg_common;
 
 
 unsigned test_randsize(unsigned *seed, unsigned bufsz)
@@ -128,6 +183,141 @@ int test_ping(unsigned seed, unsigned port, unsigned count)
 }
 
 
+/* Measures round-trip latency and throughput for message sizes from 0 to TEST_MSG_MAXSZ */
+int test_bench(unsigned seed, unsigned port, unsigned count)
+{
+	msg_t msg;
+	unsigned bufsz = TEST_MSG_MAXSZ + 2 * _PAGE_SIZE, size, row, i, k;
+	uint64_t *samples, start, total, bytes, mbps;
+	unsigned char *buf[2];
+	char name[48];
+	int random;
+
+	printf("test_msg/bench: starting, %u round trips per size\n", count);
+
+	buf[0] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+	buf[1] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+	samples = malloc(count * sizeof(*samples));
+
+	if (buf[0] == NULL || buf[1] == NULL || samples == NULL) {
+		printf("test_msg/bench: could not allocate buffers\n");
+		return 1;
+	}
+
+	for (i = 0; i < bufsz; ++i)
+		buf[0][i] = (unsigned char)rand_r(&seed);
+
+	/* Sizes 0, 1, 2, 4, ... TEST_MSG_MAXSZ followed by a pass of random sizes */
+	for (row = 0; (size = row ? 1u << (row - 1) : 0) <= 2 * TEST_MSG_MAXSZ; ++row) {
+		random = (size > TEST_MSG_MAXSZ);
+
+		for (k = 0, total = 0, bytes = 0; k < count; ++k) {
+			memset(&msg, 0, sizeof(msg));
+
+			msg.i.size = random ? test_randsize(&seed, TEST_MSG_MAXSZ) : size;
+			msg.o.size = msg.i.size;
+			msg.i.data = buf[0] + test_offset(&seed, msg.i.size, bufsz);
+			msg.o.data = buf[1] + test_offset(&seed, msg.o.size, bufsz);
+			memset(msg.o.data, 0, msg.o.size);
+
+			start = bench_time();
+
+			if (msgSend(port, &msg) < 0) {
+				printf("test_msg/bench: send failed\n");
+				return 1;
+			}
+
+			samples[k] = bench_time() - start;
+			total += samples[k];
+			bytes += msg.i.size + msg.o.size;
+
+			if (msg.o.io.err < 0 || memcmp(msg.o.data, msg.i.data, msg.i.size)) {
+				printf("test_msg/bench: data mismatch, size %zu\n", msg.i.size);
+				return 1;
+			}
+		}
+
+		if (random)
+			sprintf(name, "test_msg/bench: size random");
+		else
+			sprintf(name, "test_msg/bench: size %6u", size);
+
+		bench_print(name, samples, count);
+		/* Bytes sent and received per usec equals MB/s */
+		mbps = total ? 100 * bytes / total : 0;
+		printf("test_msg/bench: throughput %" PRIu64 ".%02u MB/s\n", mbps / 100, (unsigned)(mbps % 100));
+	}
+
+	free(samples);
+	munmap(buf[0], bufsz);
+	munmap(buf[1], bufsz);
+
+	return 0;
+}
+
+
+/* FNV-1a over 32-bit words, size has to be a multiple of 4 */
+static uint32_t test_hash(uint32_t h, const void *data, size_t size)
+{
+	const uint32_t *w = data;
+	size_t i;
+
+	for (i = 0; i < size / sizeof(*w); ++i)
+		h = (h ^ w[i]) * 16777619;
+
+	return h;
+}
+
+
+static void test_handle(msg_t *msg)
+{
+	uint32_t buf[TEST_MSG_CHUNK / sizeof(uint32_t)], h, *resp = msg->o.data;
+	const test_msg_req_t *req = msg->i.data;
+	size_t i, n;
+
+	/* Batch mode - every sub-request is answered with its inverted argument */
+	if (msg->type == test_msg_batch) {
+		n = msg->i.size / sizeof(*req);
+
+		if (msg->o.size < n * sizeof(*resp)) {
+			msg->o.io.err = -EINVAL;
+			return;
+		}
+
+		for (i = 0; i < n; ++i)
+			resp[i] = ~req[i].arg;
+
+		return;
+	}
+
+	/*
+	 * Map/copy mode - payload is hashed in place or copied out first, running hash is passed in raw.
+	 * Errors show up as hash mismatch as o.io.err shares space with o.raw.
+	 */
+	if (msg->type == test_msg_map || msg->type == test_msg_copy) {
+		memcpy(&h, msg->i.raw, sizeof(h));
+
+		if (msg->type == test_msg_map) {
+			h = test_hash(h, msg->i.data, msg->i.size);
+		}
+		else if (msg->i.size <= sizeof(buf)) {
+			memcpy(buf, msg->i.data, msg->i.size);
+			h = test_hash(h, buf, msg->i.size);
+		}
+
+		memcpy(msg->o.raw, &h, sizeof(h));
+		return;
+	}
+
+	if (msg->i.size != msg->o.size) {
+		printf("test_msg/pong: i/o buffers are of different sizes: 0x%zx and 0x%zx\n", msg->i.size, msg->o.size);
+		msg->o.io.err = 1;
+	}
+	else
+		memcpy(msg->o.data, msg->i.data, msg->i.size);
+}
+
+
 int test_pong(unsigned port)
 {
 	msg_t msg;
@@ -140,13 +330,9 @@ int test_pong(unsigned port)
 			printf("test_msg/pong: receive failed\n");
 			msg.o.io.err = 1;
 		}
-
-		if (msg.i.size != msg.o.size) {
-			printf("test_msg/pong: i/o buffers are of different sizes: 0x%zx and 0x%zx\n", msg.i.size, msg.o.size);
-			msg.o.io.err = 1;
+		else {
+			test_handle(&msg);
 		}
-		else
-			memcpy(msg.o.data, msg.i.data, msg.i.size);
 
 		msgRespond(port, &msg, rid);
 	}
@@ -155,17 +341,491 @@ int test_pong(unsigned port)
 }
 
 
+/*
+ * Scaling mode - clients and receivers are threads of one process sharing a private port.
+ * Threads are started once and reused between phases as there is no thread join.
+ */
+
+
+static void test_receiverthr(void *arg)
+{
+	unsigned i = (unsigned)(long)arg;
+	unsigned long rid;
+	msg_t msg;
+
+	while (msgRecv(test_msg_common.port, &msg, &rid) >= 0) {
+		test_handle(&msg);
+		test_msg_common.received[i]++;
+		msgRespond(test_msg_common.port, &msg, rid);
+	}
+
+	endthread();
+}
+
+
+static void test_clientthr(void *arg)
+{
+	unsigned i = (unsigned)(long)arg, k, n;
+	test_msg_client_t *client = &test_msg_common.clients[i];
+	uint32_t seq;
+	msg_t msg;
+	int active;
+
+	for (k = 0; k < sizeof(client->buf[0]); ++k)
+		client->buf[0][k] = (unsigned char)(i + k);
+
+	for (;;) {
+		mutexLock(test_msg_common.m);
+		while (client->phase == test_msg_common.phase)
+			condWait(test_msg_common.c, test_msg_common.m, 0);
+		client->phase = test_msg_common.phase;
+		active = (i < test_msg_common.nclients);
+		mutexUnlock(test_msg_common.m);
+
+		while (active && !test_msg_common.stop && !test_msg_common.batch) {
+			memset(&msg, 0, sizeof(msg));
+			msg.i.data = client->buf[0];
+			msg.o.data = client->buf[1];
+			msg.i.size = msg.o.size = sizeof(client->buf[0]);
+
+			if (msgSend(test_msg_common.port, &msg) < 0 || msg.o.io.err < 0 || memcmp(client->buf[0], client->buf[1], sizeof(client->buf[0]))) {
+				client->err = 1;
+				break;
+			}
+
+			client->count++;
+		}
+
+		for (seq = 0; active && !test_msg_common.stop && test_msg_common.batch; seq += test_msg_common.batch) {
+			n = test_msg_common.batch;
+
+			for (k = 0; k < n; ++k) {
+				client->req[k].seq = seq + k;
+				client->req[k].arg = (seq + k) * 2654435761u;
+			}
+
+			memset(&msg, 0, sizeof(msg));
+			msg.type = test_msg_batch;
+			msg.i.data = client->req;
+			msg.i.size = n * sizeof(client->req[0]);
+			msg.o.data = client->resp;
+			msg.o.size = n * sizeof(client->resp[0]);
+
+			if (msgSend(test_msg_common.port, &msg) < 0 || msg.o.io.err < 0) {
+				client->err = 1;
+				break;
+			}
+
+			for (k = 0; k < n; ++k) {
+				if (client->resp[k] != ~client->req[k].arg)
+					client->err = 1;
+			}
+
+			if (client->err)
+				break;
+
+			client->count += n;
+		}
+
+		mutexLock(test_msg_common.m);
+		test_msg_common.done++;
+		condBroadcast(test_msg_common.c);
+		mutexUnlock(test_msg_common.m);
+	}
+}
+
+
+static int test_startthr(void (*start)(void *), unsigned i)
+{
+	void *stack = malloc(TEST_MSG_STACKSZ);
+
+	if (stack == NULL)
+		return -1;
+
+	return beginthread(start, TEST_MSG_PRIO, stack, TEST_MSG_STACKSZ, (void *)(long)i);
+}
+
+
+/* Creates private port and synchronization objects */
+static int test_private(void)
+{
+	if (mutexCreate(&test_msg_common.m) < 0 || condCreate(&test_msg_common.c) < 0)
+		return -1;
+
+	return portCreate(&test_msg_common.port);
+}
+
+
+/* Runs nclients of started maxclients client threads for duration ms, batch 0 stands for echo messages */
+static int test_phase(unsigned nclients, unsigned maxclients, unsigned batch, unsigned duration, uint64_t *elapsed)
+{
+	uint64_t start;
+	unsigned i;
+
+	for (i = 0; i < maxclients; ++i)
+		test_msg_common.clients[i].count = 0;
+
+	mutexLock(test_msg_common.m);
+	test_msg_common.stop = 0;
+	test_msg_common.done = 0;
+	test_msg_common.nclients = nclients;
+	test_msg_common.batch = batch;
+	test_msg_common.phase++;
+	condBroadcast(test_msg_common.c);
+	mutexUnlock(test_msg_common.m);
+
+	start = bench_time();
+	usleep(duration * 1000);
+	test_msg_common.stop = 1;
+
+	mutexLock(test_msg_common.m);
+	while (test_msg_common.done < maxclients)
+		condWait(test_msg_common.c, test_msg_common.m, 0);
+	mutexUnlock(test_msg_common.m);
+	(*elapsed) = bench_time() - start;
+
+	for (i = 0; i < nclients; ++i) {
+		if (test_msg_common.clients[i].err)
+			return -1;
+	}
+
+	return 0;
+}
+
+
+/* Sends count messages carrying size bytes each, returns average time per message in ns */
+static int test_mapsend(int type, const unsigned char *data, size_t size, unsigned count, uint64_t *ns)
+{
+	msg_t msg;
+	uint64_t start;
+	uint32_t h, expected = test_hash(2166136261u, data, size);
+	unsigned k;
+
+	start = bench_time();
+
+	for (k = 0; k < count; ++k) {
+		h = 2166136261u;
+
+		memset(&msg, 0, sizeof(msg));
+		msg.type = type;
+		msg.i.data = (void *)data;
+		msg.i.size = size;
+		memcpy(msg.i.raw, &h, sizeof(h));
+
+		if (msgSend(test_msg_common.port, &msg) < 0) {
+			printf("test_msg/map: send failed\n");
+			return -1;
+		}
+
+		memcpy(&h, msg.o.raw, sizeof(h));
+		if (h != expected) {
+			printf("test_msg/map: checksum mismatch, size %zu\n", size);
+			return -1;
+		}
+	}
+
+	*ns = (bench_time() - start) * 1000 / count;
+
+	return 0;
+}
+
+
+/* Least squares fit of time per message ns = a + b * size, weighted by relative error as sizes span decades */
+static void test_mapfit(const uint64_t *size, const uint64_t *ns, unsigned n, float *a, float *b)
+{
+	float sw = 0, sx = 0, sy = 0, sxx = 0, sxy = 0, w, d;
+	unsigned i;
+
+	for (i = 0; i < n; ++i) {
+		w = 1.0f / ((float)ns[i] * ns[i] + 1);
+		sw += w;
+		sx += w * size[i];
+		sy += w * ns[i];
+		sxx += w * size[i] * size[i];
+		sxy += w * size[i] * ns[i];
+	}
+
+	d = sw * sxx - sx * sx;
+	*b = (d != 0) ? (sw * sxy - sx * sy) / d : 0;
+	*a = (sy - *b * sx) / sw;
+
+	if (*a < 0)
+		*a = 0;
+	if (*b < 0)
+		*b = 0;
+}
+
+
+/*
+ * Map/copy mode - compares page-aligned messages, which kernel maps into the receiver, against sub-page
+ * messages, which kernel and server copy. Both kinds are swept over their own message sizes and fitted with
+ * per message and per byte cost. Large payload has to be split into many copied messages but fits in one
+ * mapped message, so crossover is derived from these costs rather than from timing unequal message counts.
+ */
+int test_map(unsigned seed)
+{
+	unsigned char *buf = NULL;
+	size_t maxsz, size;
+	uint64_t sizes[32], ns[32];
+	unsigned i, n, count;
+	float amap, bmap, acopy, bcopy, copy;
+
+	printf("test_msg/map: starting\n");
+
+	if (test_private() < 0) {
+		printf("test_msg/map: could not create synchronization objects\n");
+		return 1;
+	}
+
+	/* Use largest payload possible on the target */
+	for (maxsz = TEST_MSG_MAXMAP; maxsz >= TEST_MSG_MINMAP; maxsz /= 2) {
+		if ((buf = mmap(NULL, maxsz + _PAGE_SIZE, PROT_READ | PROT_WRITE, 0, NULL, 0)) != NULL)
+			break;
+	}
+
+	if (buf == NULL || test_startthr(test_receiverthr, 0) < 0) {
+		printf("test_msg/map: could not allocate buffers\n");
+		return 1;
+	}
+
+	for (i = 0; i < maxsz + _PAGE_SIZE; ++i)
+		buf[i] = (unsigned char)rand_r(&seed);
+
+	/* Copied messages start off page boundary, so none of them can be mapped */
+	printf("test_msg/map: %10s %12s %12s\n", "copy size", "[ns/msg]", "[MB/s]");
+	for (size = TEST_MSG_MINCOPY, n = 0; size <= TEST_MSG_CHUNK; size *= 2, ++n) {
+		if (test_mapsend(test_msg_copy, buf + _PAGE_SIZE / 4, size, TEST_MSG_MAPMSGS, &ns[n]) < 0)
+			return 1;
+
+		sizes[n] = size;
+		printf("test_msg/map: %10zu %12" PRIu64 " %12" PRIu64 "\n", size, ns[n], ns[n] ? size * 1000 / ns[n] : 0);
+	}
+	test_mapfit(sizes, ns, n, &acopy, &bcopy);
+
+	printf("test_msg/map: %10s %12s %12s\n", "map size", "[ns/msg]", "[MB/s]");
+	for (size = TEST_MSG_MINMAP, n = 0; size <= maxsz; size *= 2, ++n) {
+		count = max(1, min(TEST_MSG_MAPMSGS, TEST_MSG_MAPBYTES / size));
+		if (test_mapsend(test_msg_map, buf, size, count, &ns[n]) < 0)
+			return 1;
+
+		sizes[n] = size;
+		printf("test_msg/map: %10zu %12" PRIu64 " %12" PRIu64 "\n", size, ns[n], ns[n] ? size * 1000 / ns[n] : 0);
+	}
+	test_mapfit(sizes, ns, n, &amap, &bmap);
+
+	printf("test_msg/map: copy %.0f ns/msg + %.2f ns/KB, map %.0f ns/msg + %.2f ns/KB\n", acopy, bcopy * 1024, amap, bmap * 1024);
+
+	/* Payload of size bytes costs amap + bmap * size mapped, or (acopy / chunk + bcopy) * size copied in chunks */
+	copy = acopy / TEST_MSG_CHUNK + bcopy;
+	if ((copy > bmap) && (amap / (copy - bmap) >= TEST_MSG_MINMAP))
+		printf("test_msg/map: one mapped message beats %u B copied messages from %.0f bytes\n", TEST_MSG_CHUNK, amap / (copy - bmap));
+	else if (copy > bmap)
+		printf("test_msg/map: one mapped message beats %u B copied messages for any page-aligned payload (crossover at %.0f bytes)\n", TEST_MSG_CHUNK, amap / (copy - bmap));
+	else
+		printf("test_msg/map: %u B copied messages are cheaper per byte than mapping\n", TEST_MSG_CHUNK);
+
+	portDestroy(test_msg_common.port);
+	munmap(buf, maxsz + _PAGE_SIZE);
+
+	return 0;
+}
+
+
+/* Returns next value of 1, 2, 4, ... max sweep, max + 1 ends it */
+static unsigned test_next(unsigned n, unsigned max)
+{
+	return (n == max) ? max + 1 : min(2 * n, max);
+}
+
+
+/* Measures aggregate message rate and per-client fairness for 1..maxclients clients and 1..maxreceivers receivers */
+int test_scale(unsigned maxclients, unsigned maxreceivers, unsigned duration)
+{
+	unsigned nclients, nreceivers, i, lo, hi, nthr = 0;
+	uint64_t elapsed, total, sum2;
+	float fairness;
+
+	printf("test_msg/scale: starting, up to %u clients and %u receivers, %u ms per run\n", maxclients, maxreceivers, duration);
+
+	if (test_private() < 0) {
+		printf("test_msg/scale: could not create synchronization objects\n");
+		return 1;
+	}
+
+	for (i = 0; i < maxclients; ++i) {
+		if (test_startthr(test_clientthr, i) < 0) {
+			printf("test_msg/scale: could not start client thread\n");
+			return 1;
+		}
+	}
+
+	for (nreceivers = 1; nreceivers <= maxreceivers; nreceivers = test_next(nreceivers, maxreceivers)) {
+		for (; nthr < nreceivers; ++nthr) {
+			if (test_startthr(test_receiverthr, nthr) < 0) {
+				printf("test_msg/scale: could not start receiver thread\n");
+				return 1;
+			}
+		}
+
+		for (nclients = 1; nclients <= maxclients; nclients = test_next(nclients, maxclients)) {
+			for (i = 0; i < nreceivers; ++i)
+				test_msg_common.received[i] = 0;
+
+			if (test_phase(nclients, maxclients, 0, duration, &elapsed) < 0) {
+				printf("test_msg/scale: client failed\n");
+				return 1;
+			}
+
+			for (i = 0, total = 0, sum2 = 0; i < nclients; ++i) {
+				total += test_msg_common.clients[i].count;
+				sum2 += (uint64_t)test_msg_common.clients[i].count * test_msg_common.clients[i].count;
+			}
+
+			/* Jain's fairness index, 1 - all clients served equally, 1/n - one client served */
+			fairness = sum2 ? (float)total * total / (nclients * (float)sum2) : 0;
+
+			for (i = 0, lo = ~0u, hi = 0; i < nreceivers; ++i) {
+				lo = min(lo, test_msg_common.received[i]);
+				hi = max(hi, test_msg_common.received[i]);
+			}
+
+			printf("test_msg/scale: clients %2u receivers %2u: %" PRIu64 " msg/s, fairness %.3f, per receiver %u..%u msgs\n",
+				nclients, nreceivers, elapsed ? total * 1000000 / elapsed : 0, fairness, lo, hi);
+		}
+	}
+
+	portDestroy(test_msg_common.port);
+
+	return 0;
+}
+
+
+/* Measures per-request cost with 1..maxclients requests in flight and 1..maxbatch sub-requests per message */
+int test_batch(unsigned maxclients, unsigned maxbatch, unsigned duration)
+{
+	unsigned nclients, batch, i;
+	uint64_t elapsed, total, base = 0;
+
+	printf("test_msg/batch: starting, up to %u clients and %u sub-requests per message, %u ms per run\n", maxclients, maxbatch, duration);
+
+	if (test_private() < 0) {
+		printf("test_msg/batch: could not create synchronization objects\n");
+		return 1;
+	}
+
+	/* Single receiver as in most servers, pipelined requests queue up on the port */
+	if (test_startthr(test_receiverthr, 0) < 0) {
+		printf("test_msg/batch: could not start receiver thread\n");
+		return 1;
+	}
+
+	for (i = 0; i < maxclients; ++i) {
+		if (test_startthr(test_clientthr, i) < 0) {
+			printf("test_msg/batch: could not start client thread\n");
+			return 1;
+		}
+	}
+
+	printf("test_msg/batch: %8s %8s %12s %12s %14s %8s\n", "clients", "batch", "req/s", "msg/s", "ns per req", "speedup");
+
+	for (nclients = 1; nclients <= maxclients; nclients = test_next(nclients, maxclients)) {
+		for (batch = 1; batch <= maxbatch; batch = test_next(batch, maxbatch)) {
+			if (test_phase(nclients, maxclients, batch, duration, &elapsed) < 0) {
+				printf("test_msg/batch: client failed\n");
+				return 1;
+			}
+
+			for (i = 0, total = 0; i < nclients; ++i)
+				total += test_msg_common.clients[i].count;
+
+			/* Cost of one synchronous request is the reference */
+			if (base == 0)
+				base = total ? elapsed * 1000 / total : 0;
+
+			printf("test_msg/batch: %8u %8u %12" PRIu64 " %12" PRIu64 " %14" PRIu64 " %7.2fx\n", nclients, batch,
+				elapsed ? total * 1000000 / elapsed : 0, elapsed ? total * 1000000 / elapsed / batch : 0,
+				total ? elapsed * 1000 / total : 0, total ? (float)base * total / (elapsed * 1000) : 0);
+		}
+	}
+
+	portDestroy(test_msg_common.port);
+
+	return 0;
+}
+
+
+void test_help(const char *prog)
+{
+	printf("Usage: %s [-b | -z | -s clients:receivers | -p clients:batch] [-d ms] [count] [seed]\n", prog);
+	printf("\tFirst instance registers server port, next ones ping it count times (0 - forever)\n");
+	printf("\t-b          - measure latency and throughput, count round trips per message size\n");
+	printf("\t-s c:r      - measure message rate scaling up to c clients and r receivers on private port\n");
+	printf("\t-p c:k      - measure request cost pipelining up to c clients batching up to k requests per message\n");
+	printf("\t-d ms       - duration of single scaling/batch run (default 1000)\n");
+	printf("\t-z          - compare mapped and copied payloads from %u B to %u MB on private port\n", TEST_MSG_MINMAP, TEST_MSG_MAXMAP >> 20);
+	printf("\t-h          - prints this help message\n");
+}
+
+
 int main(int argc, char **argv)
 {
 	oid_t oid;
 	char portname[] = "/tes_tmsg";
-	unsigned count = 0, seed = 123;
-	int err;
+	unsigned count = 0, seed = 123, clients = 0, receivers = 0, batch = 0, duration = 1000;
+	int err, c, bench = 0, map = 0;
+
+	while ((c = getopt(argc, argv, "bzs:p:d:h")) != -1) {
+		switch (c) {
+			case 'b':
+				bench = 1;
+				break;
+
+			case 'z':
+				map = 1;
+				break;
+
+			case 's':
+				if (sscanf(optarg, "%u:%u", &clients, &receivers) != 2 || !clients || !receivers || clients > TEST_MSG_MAXTHR || receivers > TEST_MSG_MAXTHR) {
+					printf("test_msg: clients and receivers have to be in range 1..%d\n", TEST_MSG_MAXTHR);
+					return 1;
+				}
+				break;
+
+			case 'p':
+				if (sscanf(optarg, "%u:%u", &clients, &batch) != 2 || !clients || !batch || clients > TEST_MSG_MAXTHR || batch > TEST_MSG_MAXBATCH) {
+					printf("test_msg: clients have to be in range 1..%d, batch in range 1..%d\n", TEST_MSG_MAXTHR, TEST_MSG_MAXBATCH);
+					return 1;
+				}
+				break;
+
+			case 'd':
+				duration = strtoul(optarg, NULL, 10);
+				break;
+
+			case 'h':
+			default:
+				test_help(argv[0]);
+				return 0;
+		}
+	}
 
 	/* Wait for console */
 	while (write(1, "", 0) < 0)
 		usleep(10000);
 
+	/* Scaling, batch and map modes use private port, no server lookup needed */
+	if (batch)
+		return test_batch(clients, batch, duration);
+
+	if (clients)
+		return test_scale(clients, receivers, duration);
+
+	if (map) {
+		if (optind + 1 < argc)
+			seed = strtoul(argv[optind + 1], NULL, 10);
+		return test_map(seed);
+	}
+
 	/* Wait for filesystem */
 	while (lookup("/", NULL, &oid) < 0)
 		usleep(10000);
@@ -191,11 +851,14 @@ int main(int argc, char **argv)
 	printf("Found server at %d\n", oid.port);
 	fflush(stdout);
 
-	if (argc > 1)
-		count = strtoul(argv[1], NULL, 10);
+	if (optind < argc)
+		count = strtoul(argv[optind], NULL, 10);
+
+	if (optind + 1 < argc)
+		seed = strtoul(argv[optind + 1], NULL, 10);
 
-	if (argc > 2)
-		seed = strtoul(argv[2], NULL, 10);
+	if (bench)
+		return test_bench(seed, oid.port, count ? count : 1000);
 
 	return test_ping(seed, oid.port, count);
 }
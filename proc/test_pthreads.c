@@ -15,14 +15,64 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <unistd.h>
 #include "pthread.h"
+#include "sys/threads.h"
+#include "sys/minmax.h"
+
+#include "../test_common.h"
 
 #define TEST_CREATE_JOIN_NUM 100
 #define TEST_MUTEX 5
 #define TEST_EQUAL 2
 
+#define BENCH_OPS     100000 /* Default operations per benchmark */
+#define BENCH_MAXTHR  8
+#define BENCH_WRITERS 16     /* One in BENCH_WRITERS rwlock operations is a write */
+#define BENCH_ROUNDS  100    /* Broadcast fan-out rounds */
+#define BENCH_SPAWNS  2000   /* Default threads created by spawn benchmark */
+#define BENCH_POOL    4      /* Threads alive at once in batched spawn and thread pool */
+#define BENCH_STACKSZ 16384  /* User supplied stack size */
+
+
+enum { bench_pthread = 0, bench_native, bench_rwlock };
+
+
+static const char *bench_names[] = { "pthread", "native", "rwlock" };
+
+
+static struct {
+	pthread_mutex_t pm;
+	pthread_cond_t pc;
+	pthread_rwlock_t rw;
+	handle_t m;
+	handle_t c;
+
+	int api;
+	unsigned int ops;
+	unsigned int nthreads;
+	volatile unsigned int counter;
+	uint64_t start[BENCH_MAXTHR];
+	uint64_t end[BENCH_MAXTHR];
+
+	/* Broadcast fan-out state */
+	volatile unsigned int gen;
+	volatile unsigned int waiting;
+	volatile unsigned int woken;
+	volatile uint64_t t0;
+	volatile uint64_t last;
+
+	/* Thread pool state */
+	pthread_cond_t pjob;
+	pthread_cond_t pdone;
+	unsigned int queued;
+	unsigned int completed;
+	int quit;
+	void *stacks[BENCH_POOL];
+} test_pthreads_common;
+
 
 static void *worker(void *arg)
 {
@@ -275,11 +325,471 @@ static int test_pthread_create_detach(int num_threads)
 };
 
 
-int main(void)
+/*
+ * Pthread vs native synchronization benchmark:
+ */
+
+static inline void bench_lock(int api)
+{
+	if (api == bench_native)
+		mutexLock(test_pthreads_common.m);
+	else
+		pthread_mutex_lock(&test_pthreads_common.pm);
+}
+
+
+static inline void bench_unlock(int api)
+{
+	if (api == bench_native)
+		mutexUnlock(test_pthreads_common.m);
+	else
+		pthread_mutex_unlock(&test_pthreads_common.pm);
+}
+
+
+static void bench_uncontended(int api, unsigned int ops)
+{
+	unsigned int i;
+	uint64_t t;
+
+	t = bench_time();
+	for (i = 0; i < ops; i++) {
+		bench_lock(api);
+		bench_unlock(api);
+	}
+	t = bench_time() - t;
+
+	printf("test_pthreads/uncontended %s: %u ops, %" PRIu64 " ns/op\n", bench_names[api], ops, (t * 1000) / ops);
+}
+
+
+/* Lock/unlock loop, rwlock variant takes write lock once per BENCH_WRITERS operations */
+static void *bench_contender(void *arg)
+{
+	unsigned int id = (unsigned int)(long)arg, i, n, v;
+	int api = test_pthreads_common.api;
+
+	n = test_pthreads_common.ops / test_pthreads_common.nthreads;
+	test_pthreads_common.start[id] = bench_time();
+
+	for (i = 0; i < n; i++) {
+		if (api != bench_rwlock) {
+			bench_lock(api);
+			test_pthreads_common.counter++;
+			bench_unlock(api);
+		}
+		else if ((i % BENCH_WRITERS) == 0) {
+			pthread_rwlock_wrlock(&test_pthreads_common.rw);
+			test_pthreads_common.counter++;
+			pthread_rwlock_unlock(&test_pthreads_common.rw);
+		}
+		else {
+			pthread_rwlock_rdlock(&test_pthreads_common.rw);
+			v = test_pthreads_common.counter;
+			pthread_rwlock_unlock(&test_pthreads_common.rw);
+			(void)v;
+		}
+	}
+
+	test_pthreads_common.end[id] = bench_time();
+
+	return NULL;
+}
+
+
+static int bench_contended(int api, unsigned int nthreads, unsigned int ops)
+{
+	pthread_t threads[BENCH_MAXTHR];
+	unsigned int i, created, done, expected;
+	uint64_t start = (uint64_t)-1, end = 0;
+	int err = 0;
+
+	test_pthreads_common.api = api;
+	test_pthreads_common.ops = ops;
+	test_pthreads_common.nthreads = nthreads;
+	test_pthreads_common.counter = 0;
+
+	for (created = 0; created < nthreads; created++) {
+		if ((err = pthread_create(&threads[created], NULL, bench_contender, (void *)(long)created)) != EOK) {
+			printf("test_pthreads: failed to create contender thread. Error: %d\n", err);
+			break;
+		}
+	}
+
+	for (i = 0; i < created; i++) {
+		pthread_join(threads[i], NULL);
+		start = min(start, test_pthreads_common.start[i]);
+		end = max(end, test_pthreads_common.end[i]);
+	}
+
+	if (err != EOK)
+		return -1;
+
+	/* Only writers modify counter in rwlock variant */
+	done = (ops / nthreads) * nthreads;
+	expected = done;
+	if (api == bench_rwlock)
+		expected = ((ops / nthreads + BENCH_WRITERS - 1) / BENCH_WRITERS) * nthreads;
+
+	if (test_pthreads_common.counter != expected) {
+		printf("test_pthreads: %s counter %u, expected %u\n", bench_names[api], test_pthreads_common.counter, expected);
+		return -1;
+	}
+
+	printf("test_pthreads/contended %s: threads %u, %" PRIu64 " ops/s\n", bench_names[api], nthreads,
+		(uint64_t)done * 1000000 / max(end - start, 1));
+
+	return 0;
+}
+
+
+/* Waits until *v reaches n, polling outside of the lock */
+static void bench_poll(int api, volatile unsigned int *v, unsigned int n)
+{
+	bench_lock(api);
+	while (*v < n) {
+		bench_unlock(api);
+		usleep(100);
+		bench_lock(api);
+	}
+}
+
+
+static void *bench_waiter(void *arg)
+{
+	int api = test_pthreads_common.api;
+	unsigned int g;
+
+	bench_lock(api);
+	for (g = 0; g < BENCH_ROUNDS; g++) {
+		test_pthreads_common.waiting++;
+
+		while (test_pthreads_common.gen == g) {
+			if (api == bench_native)
+				condWait(test_pthreads_common.c, test_pthreads_common.m, 0);
+			else
+				pthread_cond_wait(&test_pthreads_common.pc, &test_pthreads_common.pm);
+		}
+
+		/* Waiters wake up serialized on the mutex, the last one sets the round latency */
+		test_pthreads_common.last = bench_time() - test_pthreads_common.t0;
+		test_pthreads_common.woken++;
+	}
+	bench_unlock(api);
+
+	return NULL;
+}
+
+
+static int bench_fanout(int api, unsigned int nthreads)
+{
+	pthread_t threads[BENCH_MAXTHR];
+	uint64_t samples[BENCH_ROUNDS];
+	unsigned int i, g;
+	char name[64];
+	int err;
+
+	test_pthreads_common.api = api;
+	test_pthreads_common.gen = 0;
+	test_pthreads_common.waiting = 0;
+
+	for (i = 0; i < nthreads; i++) {
+		if ((err = pthread_create(&threads[i], NULL, bench_waiter, NULL)) != EOK) {
+			/* Running waiters would never finish */
+			printf("test_pthreads: failed to create waiter thread. Error: %d\n", err);
+			exit(1);
+		}
+	}
+
+	for (g = 0; g < BENCH_ROUNDS; g++) {
+		bench_poll(api, &test_pthreads_common.waiting, nthreads);
+		test_pthreads_common.waiting = 0;
+		test_pthreads_common.woken = 0;
+		test_pthreads_common.gen++;
+		test_pthreads_common.t0 = bench_time();
+
+		if (api == bench_native)
+			condBroadcast(test_pthreads_common.c);
+		else
+			pthread_cond_broadcast(&test_pthreads_common.pc);
+		bench_unlock(api);
+
+		bench_poll(api, &test_pthreads_common.woken, nthreads);
+		samples[g] = test_pthreads_common.last;
+		bench_unlock(api);
+	}
+
+	for (i = 0; i < nthreads; i++)
+		pthread_join(threads[i], NULL);
+
+	snprintf(name, sizeof(name), "test_pthreads/fanout %s %u", bench_names[api], nthreads);
+	bench_print(name, samples, BENCH_ROUNDS);
+
+	return 0;
+}
+
+
+static int test_pthread_bench(unsigned int ops)
+{
+	unsigned int n;
+	int api;
+
+	if (ops < BENCH_MAXTHR) {
+		printf("test_pthreads: at least %u operations needed, got %u\n", BENCH_MAXTHR, ops);
+		return 1;
+	}
+
+	if (pthread_mutex_init(&test_pthreads_common.pm, NULL) != EOK || pthread_cond_init(&test_pthreads_common.pc, NULL) != EOK ||
+			pthread_rwlock_init(&test_pthreads_common.rw, NULL) != EOK || mutexCreate(&test_pthreads_common.m) < 0 ||
+			condCreate(&test_pthreads_common.c) < 0) {
+		printf("test_pthreads: failed to create benchmark locks\n");
+		return 1;
+	}
+
+	printf("test_pthreads: synchronization benchmark, %u ops\n", ops);
+
+	for (api = bench_pthread; api <= bench_native; api++)
+		bench_uncontended(api, ops);
+
+	for (api = bench_pthread; api <= bench_rwlock; api++) {
+		for (n = 1; n <= BENCH_MAXTHR; n *= 2) {
+			if (bench_contended(api, n, ops) < 0)
+				return 1;
+		}
+	}
+
+	for (api = bench_pthread; api <= bench_native; api++) {
+		for (n = 1; n <= BENCH_MAXTHR; n *= 2)
+			bench_fanout(api, n);
+	}
+
+	return 0;
+}
+
+
+/*
+ * Thread create/join benchmark:
+ */
+
+static void *bench_nop(void *arg)
+{
+	return arg;
+}
+
+
+static int bench_spawn(const char *kind, pthread_attr_t *attrs, unsigned int count)
+{
+	pthread_t threads[BENCH_POOL];
+	uint64_t *create, *join, t;
+	unsigned int i, j;
+	char name[64];
+	int err = EOK;
+
+	create = malloc(count * sizeof(*create));
+	join = malloc(count * sizeof(*join));
+	if (create == NULL || join == NULL) {
+		printf("test_pthreads: failed to allocate samples\n");
+		free(create);
+		free(join);
+		return -1;
+	}
+
+	/* One thread at a time, per operation latency */
+	for (i = 0; i < count; i++) {
+		t = bench_time();
+		if ((err = pthread_create(&threads[0], (attrs != NULL) ? &attrs[0] : NULL, bench_nop, NULL)) != EOK)
+			break;
+		create[i] = bench_time() - t;
+
+		t = bench_time();
+		pthread_join(threads[0], NULL);
+		join[i] = bench_time() - t;
+	}
+
+	if (err == EOK) {
+		snprintf(name, sizeof(name), "test_pthreads/spawn %s create", kind);
+		bench_print(name, create, count);
+		snprintf(name, sizeof(name), "test_pthreads/spawn %s join", kind);
+		bench_print(name, join, count);
+
+		/* BENCH_POOL threads alive at once */
+		t = bench_time();
+		for (i = 0; i < count && err == EOK; i += BENCH_POOL) {
+			for (j = 0; j < BENCH_POOL; j++) {
+				if ((err = pthread_create(&threads[j], (attrs != NULL) ? &attrs[j] : NULL, bench_nop, NULL)) != EOK)
+					break;
+			}
+
+			while (j-- > 0)
+				pthread_join(threads[j], NULL);
+		}
+		t = bench_time() - t;
+
+		if (err == EOK) {
+			printf("test_pthreads/spawn %s: %u threads in batches of %u, %" PRIu64 " threads/s\n", kind,
+				i, BENCH_POOL, (uint64_t)i * 1000000 / max(t, 1));
+		}
+	}
+
+	free(create);
+	free(join);
+
+	if (err != EOK) {
+		printf("test_pthreads: failed to create %s thread. Error: %d\n", kind, err);
+		return -1;
+	}
+
+	return 0;
+}
+
+
+static void *bench_poolthr(void *arg)
+{
+	pthread_mutex_lock(&test_pthreads_common.pm);
+	for (;;) {
+		while (test_pthreads_common.queued == 0 && !test_pthreads_common.quit)
+			pthread_cond_wait(&test_pthreads_common.pjob, &test_pthreads_common.pm);
+
+		if (test_pthreads_common.queued == 0)
+			break;
+
+		test_pthreads_common.queued--;
+		pthread_mutex_unlock(&test_pthreads_common.pm);
+
+		bench_nop(NULL);
+
+		pthread_mutex_lock(&test_pthreads_common.pm);
+		test_pthreads_common.completed++;
+		pthread_cond_signal(&test_pthreads_common.pdone);
+	}
+	pthread_mutex_unlock(&test_pthreads_common.pm);
+
+	return NULL;
+}
+
+
+/* Runs the same jobs as bench_spawn on persistent worker threads */
+static int bench_pool(unsigned int count)
+{
+	pthread_t threads[BENCH_POOL];
+	uint64_t *samples, t;
+	unsigned int i, n;
+	int err = EOK;
+
+	if ((samples = malloc(count * sizeof(*samples))) == NULL) {
+		printf("test_pthreads: failed to allocate samples\n");
+		return -1;
+	}
+
+	test_pthreads_common.queued = 0;
+	test_pthreads_common.completed = 0;
+	test_pthreads_common.quit = 0;
+
+	for (n = 0; n < BENCH_POOL; n++) {
+		if ((err = pthread_create(&threads[n], NULL, bench_poolthr, NULL)) != EOK) {
+			printf("test_pthreads: failed to create pool thread. Error: %d\n", err);
+			break;
+		}
+	}
+
+	if (err == EOK) {
+		/* One job at a time, submit to completion latency */
+		for (i = 0; i < count; i++) {
+			t = bench_time();
+			pthread_mutex_lock(&test_pthreads_common.pm);
+			test_pthreads_common.queued++;
+			pthread_cond_signal(&test_pthreads_common.pjob);
+			while (test_pthreads_common.completed <= i)
+				pthread_cond_wait(&test_pthreads_common.pdone, &test_pthreads_common.pm);
+			pthread_mutex_unlock(&test_pthreads_common.pm);
+			samples[i] = bench_time() - t;
+		}
+
+		bench_print("test_pthreads/pool job", samples, count);
+
+		/* All jobs queued at once */
+		t = bench_time();
+		pthread_mutex_lock(&test_pthreads_common.pm);
+		test_pthreads_common.queued += count;
+		pthread_cond_broadcast(&test_pthreads_common.pjob);
+		while (test_pthreads_common.completed < 2 * count)
+			pthread_cond_wait(&test_pthreads_common.pdone, &test_pthreads_common.pm);
+		pthread_mutex_unlock(&test_pthreads_common.pm);
+		t = bench_time() - t;
+
+		printf("test_pthreads/pool: %u jobs on %u threads, %" PRIu64 " jobs/s\n", count, BENCH_POOL, (uint64_t)count * 1000000 / max(t, 1));
+	}
+
+	pthread_mutex_lock(&test_pthreads_common.pm);
+	test_pthreads_common.quit = 1;
+	pthread_cond_broadcast(&test_pthreads_common.pjob);
+	pthread_mutex_unlock(&test_pthreads_common.pm);
+
+	while (n-- > 0)
+		pthread_join(threads[n], NULL);
+
+	free(samples);
+
+	return (err == EOK) ? 0 : -1;
+}
+
+
+static int test_pthread_spawn_bench(unsigned int count)
+{
+	pthread_attr_t attrs[BENCH_POOL];
+	unsigned int i;
+	int err = 0;
+
+	if (count < BENCH_POOL) {
+		printf("test_pthreads: at least %u spawns needed, got %u\n", BENCH_POOL, count);
+		return 1;
+	}
+
+	if (pthread_mutex_init(&test_pthreads_common.pm, NULL) != EOK || pthread_cond_init(&test_pthreads_common.pjob, NULL) != EOK ||
+			pthread_cond_init(&test_pthreads_common.pdone, NULL) != EOK) {
+		printf("test_pthreads: failed to create benchmark locks\n");
+		return 1;
+	}
+
+	/* Stacks are reused after join, like the explicit stacks passed to beginthread */
+	for (i = 0; i < BENCH_POOL; i++) {
+		if ((test_pthreads_common.stacks[i] = malloc(BENCH_STACKSZ)) == NULL) {
+			printf("test_pthreads: failed to allocate stacks\n");
+			return 1;
+		}
+
+		pthread_attr_init(&attrs[i]);
+		if (pthread_attr_setstack(&attrs[i], test_pthreads_common.stacks[i], BENCH_STACKSZ) != EOK) {
+			printf("test_pthreads: failed to set user stack\n");
+			return 1;
+		}
+	}
+
+	printf("test_pthreads: thread spawn benchmark, %u threads\n", count);
+
+	if (bench_spawn("default", NULL, count) < 0 || bench_spawn("stack", attrs, count) < 0 || bench_pool(count) < 0)
+		err = 1;
+
+	for (i = 0; i < BENCH_POOL; i++) {
+		pthread_attr_destroy(&attrs[i]);
+		free(test_pthreads_common.stacks[i]);
+	}
+
+	return err;
+}
+
+
+int main(int argc, char *argv[])
 {
 	int passed = 0;
 	int num_tests = 0;
 
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		return test_pthread_bench((argc > 2) ? strtoul(argv[2], NULL, 10) : BENCH_OPS);
+
+	if (argc > 1 && strcmp(argv[1], "-t") == 0)
+		return test_pthread_spawn_bench((argc > 2) ? strtoul(argv[2], NULL, 10) : BENCH_SPAWNS);
+
 	printf("test_pthreads: Starting, main is at %p\n\n", main);
 
 	printf("test_pthreads: Testing thread create/join:\n");
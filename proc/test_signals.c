@@ -17,7 +17,42 @@
 #include "stdio.h"
 #include "string.h"
 #include "unistd.h"
+#include "signal.h"
 #include "sys/threads.h"
+#include "sys/minmax.h"
+#include "sys/mman.h"
+#include "sys/wait.h"
+
+#include "../test_common.h"
+
+#define BENCH_SIGNAL SIGUSR1
+#define BENCH_COUNT  1000
+#define BENCH_TIMEOUT 100000 /* Time after which one at a time signal is counted as lost, in us */
+
+
+/* Shared between benchmark receiver (parent) and poster (child) */
+struct bench_shm {
+	volatile int phase;
+	volatile uint64_t t0;
+	volatile unsigned int seq;      /* Outstanding one at a time post, 0 if none */
+	volatile unsigned int acked;    /* Last post handled */
+	volatile unsigned int measured; /* Latency samples taken */
+	volatile unsigned int received;
+	volatile unsigned int posted;
+	volatile unsigned int lost;
+	volatile unsigned int late;
+	volatile uint64_t elapsed;
+};
+
+
+static struct {
+	struct bench_shm *shm;
+	uint64_t *samples;
+	unsigned int count;
+} test_signals_common;
+
+
+enum { bench_idle = 0, bench_latency, bench_measured, bench_flood, bench_done };
 
 
 void handler(int s)
@@ -46,8 +81,158 @@ void signaler(void)
 }
 
 
-int main(void)
+/* Runs in receiver, records post-to-handler latency of outstanding post in latency phase */
+void bench_handler(int s)
+{
+	struct bench_shm *shm = test_signals_common.shm;
+	unsigned int seq = shm->seq;
+
+	if (shm->phase == bench_latency) {
+		/* Signal of timed out post or repeated delivery doesn't belong to outstanding post */
+		if ((seq == 0) || (seq == shm->acked)) {
+			shm->late++;
+		}
+		else {
+			if (shm->measured < test_signals_common.count)
+				test_signals_common.samples[shm->measured++] = bench_time() - shm->t0;
+			shm->acked = seq;
+		}
+	}
+
+	shm->received++;
+	signalReturn(s);
+}
+
+
+static void bench_wait(volatile int *phase, int value)
+{
+	while (*phase != value)
+		usleep(1000);
+}
+
+
+/* Posts signals to receiver, one at a time, then back-to-back */
+void bench_poster(pid_t ppid)
+{
+	struct bench_shm *shm = test_signals_common.shm;
+	unsigned int k;
+	uint64_t t;
+
+	signalMask(0xffffffff, 0xffffffff);
+
+	bench_wait(&shm->phase, bench_latency);
+	/* Signals coalesce or get lost, so don't wait for any of them forever */
+	for (k = 1; k <= test_signals_common.count; k++) {
+		shm->t0 = t = bench_time();
+		shm->seq = k;
+		signalPost(ppid, -1, BENCH_SIGNAL);
+
+		while (shm->acked != k && bench_time() - t < BENCH_TIMEOUT)
+			usleep(100);
+
+		if (shm->acked != k) {
+			/*
+			 * Close the post, so its late delivery isn't taken for the next one, and let it drain. Signals carry
+			 * no payload, so delivery later than twice BENCH_TIMEOUT would still be taken for the next post.
+			 */
+			shm->seq = 0;
+			shm->lost++;
+			usleep(BENCH_TIMEOUT);
+		}
+	}
+	shm->seq = 0;
+	shm->phase = bench_measured;
+
+	bench_wait(&shm->phase, bench_flood);
+	t = bench_time();
+	for (k = 0; k < test_signals_common.count; k++)
+		signalPost(ppid, -1, BENCH_SIGNAL);
+	shm->elapsed = bench_time() - t;
+	shm->posted = k;
+
+	shm->phase = bench_done;
+	exit(0);
+}
+
+
+static int test_signals_bench(unsigned int count)
 {
+	struct bench_shm *shm;
+	unsigned int k, old, received;
+	int status;
+	pid_t pid;
+	uint64_t t;
+
+	test_signals_common.count = count;
+	test_signals_common.samples = malloc(count * sizeof(*test_signals_common.samples));
+	shm = mmap(NULL, _PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, NULL, 0);
+
+	if (test_signals_common.samples == NULL || shm == NULL || shm == MAP_FAILED) {
+		printf("test_signals: failed to allocate benchmark memory\n");
+		return 1;
+	}
+
+	memset(shm, 0, sizeof(*shm));
+	test_signals_common.shm = shm;
+
+	/* signalMask cost, no signals pending */
+	t = bench_time();
+	for (k = 0; k < count; k++) {
+		old = signalMask(0xffffffff, 0xffffffff);
+		signalMask(old, 0xffffffff);
+	}
+	t = bench_time() - t;
+	printf("test_signals/mask: %u mask/unmask pairs, %" PRIu64 " ns/pair\n", count, t * 1000 / count);
+
+	signalHandle(bench_handler, 0, 0);
+	signalMask(~(1u << BENCH_SIGNAL), 0xffffffff);
+
+	fflush(stdout);
+	if ((pid = fork()) < 0) {
+		printf("test_signals: fork failed\n");
+		return 1;
+	}
+
+	if (pid == 0)
+		bench_poster(getppid());
+
+	t = bench_time();
+	shm->phase = bench_latency;
+	bench_wait(&shm->phase, bench_measured);
+	t = bench_time() - t;
+
+	/* Only deliveries matching outstanding post are sampled, late ones are counted apart */
+	received = shm->measured;
+	if (received > 0)
+		bench_print("test_signals/latency", test_signals_common.samples, received);
+	printf("test_signals/latency: %u signals one at a time, %u handled, %u lost (no delivery within %u us), %u late, %" PRIu64 " signals/s\n",
+		count, received, shm->lost, BENCH_TIMEOUT, shm->late, (uint64_t)received * 1000000 / max(t, 1));
+
+	/* Poster may still be checking the counter, so don't reset it */
+	received = shm->received;
+	shm->phase = bench_flood;
+	bench_wait(&shm->phase, bench_done);
+
+	/* Let last pending signal arrive */
+	usleep(10000);
+	received = shm->received - received;
+
+	/* Pending signal is a bit, posts coalesce when receiver falls behind */
+	printf("test_signals/flood: posted %u in %" PRIu64 " us (%" PRIu64 " posts/s), handled %u (%" PRIu64 " signals/s)\n",
+		shm->posted, shm->elapsed, (uint64_t)shm->posted * 1000000 / max(shm->elapsed, 1),
+		received, (uint64_t)received * 1000000 / max(shm->elapsed, 1));
+
+	waitpid(pid, &status, 0);
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		return test_signals_bench((argc > 2 && atoi(argv[2]) > 0) ? atoi(argv[2]) : BENCH_COUNT);
+
 	printf("test_signals: start (%x)\n", getpid());
 
 	if (!fork())
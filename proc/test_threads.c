@@ -15,9 +15,25 @@
 
 #include "stdio.h"
 #include "stdlib.h"
+#include "string.h"
 #include "unistd.h"
 #include "sys/threads.h"
 
+#include "../test_common.h"
+
+#define BENCH_STACKSZ   2048
+#define BENCH_PERIOD    1000  /* Preemption test sleep period [us] */
+#define BENCH_CS        200   /* Priority inversion test critical section [us] */
+#define BENCH_BUDGET    20000 /* Priority inversion test busy thread budget [us] */
+#define BENCH_INVERSION 10    /* Priority inversion test iterations */
+
+/* Benchmark priorities, main thread runs above all to stop busy threads */
+#define BENCH_PRIO_MAIN 1
+#define BENCH_PRIO_HIGH 2
+#define BENCH_PRIO_MID  3
+#define BENCH_PRIO_BUSY 4
+#define BENCH_PRIO_LOW  5
+
 
 struct {
 	volatile unsigned int rotations[8];
@@ -25,6 +41,21 @@ struct {
 	volatile time_t tm;
 	handle_t m;
 	handle_t c;
+
+	/* Benchmark state */
+	volatile int stop;
+	handle_t c2;
+	handle_t cdone;
+	handle_t mi;
+	unsigned int count;
+	unsigned int running;
+	volatile int waiting;
+	volatile int wake;
+	volatile int turn;
+	volatile int held;
+	volatile uint64_t t0;
+	uint64_t *samples;
+	uint64_t inversion[BENCH_INVERSION];
 } test_threads_common;
 
 
@@ -35,8 +66,8 @@ struct {
 
 static void test_threads_busythr(void *arg)
 {
-	for (;;);
-	return;
+	while (!test_threads_common.stop);
+	endthread();
 }
 
 
@@ -143,12 +174,319 @@ void test_threads_threads2(void)
 }
 
 
-int main(void)
+/*
+ * Scheduler benchmark
+ */
+
+
+static int bench_start(void (*start)(void *), unsigned int prio)
+{
+	void *stack = malloc(BENCH_STACKSZ);
+
+	if (stack == NULL)
+		return -1;
+
+	return beginthread(start, prio, stack, BENCH_STACKSZ, NULL);
+}
+
+
+/* Marks benchmark thread as finished */
+static void bench_done(void)
+{
+	mutexLock(test_threads_common.m);
+	test_threads_common.running--;
+	condBroadcast(test_threads_common.cdone);
+	mutexUnlock(test_threads_common.m);
+}
+
+
+static void bench_exit(void)
+{
+	bench_done();
+	endthread();
+}
+
+
+static void bench_wait(void)
+{
+	mutexLock(test_threads_common.m);
+	while (test_threads_common.running)
+		condWait(test_threads_common.cdone, test_threads_common.m, 0);
+	mutexUnlock(test_threads_common.m);
+}
+
+
+static int bench_run(const char *name, void (*a)(void *), void (*b)(void *), unsigned int prio)
+{
+	char s[64];
+
+	test_threads_common.running = 2;
+	test_threads_common.waiting = 0;
+	test_threads_common.wake = 0;
+	test_threads_common.turn = 0;
+
+	if (bench_start(a, prio) < 0 || bench_start(b, prio) < 0) {
+		printf("test_threads: failed to start %s threads\n", name);
+		return -1;
+	}
+
+	bench_wait();
+
+	snprintf(s, sizeof(s), "test_threads/%s", name);
+	bench_print(s, test_threads_common.samples, test_threads_common.count);
+	bench_histogram(s, test_threads_common.samples, test_threads_common.count);
+
+	return 0;
+}
+
+
+/* Measures time from condSignal to the return of waiter's condWait */
+static void bench_waiterthr(void *arg)
+{
+	unsigned int k;
+
+	mutexLock(test_threads_common.m);
+	for (k = 0; k < test_threads_common.count; k++) {
+		test_threads_common.waiting = 1;
+		condSignal(test_threads_common.c2);
+
+		while (!test_threads_common.wake)
+			condWait(test_threads_common.c, test_threads_common.m, 0);
+
+		test_threads_common.samples[k] = bench_time() - test_threads_common.t0;
+		test_threads_common.wake = 0;
+	}
+	mutexUnlock(test_threads_common.m);
+
+	bench_exit();
+}
+
+
+static void bench_signalerthr(void *arg)
+{
+	unsigned int k;
+
+	mutexLock(test_threads_common.m);
+	for (k = 0; k < test_threads_common.count; k++) {
+		while (!test_threads_common.waiting)
+			condWait(test_threads_common.c2, test_threads_common.m, 0);
+
+		test_threads_common.waiting = 0;
+		test_threads_common.wake = 1;
+		test_threads_common.t0 = bench_time();
+		condSignal(test_threads_common.c);
+	}
+	mutexUnlock(test_threads_common.m);
+
+	bench_exit();
+}
+
+
+/* Measures round trip of mutex handoff between two threads */
+static void bench_pingthr(void *arg)
+{
+	unsigned int k;
+	uint64_t t0;
+
+	mutexLock(test_threads_common.m);
+	for (k = 0; k < test_threads_common.count; k++) {
+		t0 = bench_time();
+		test_threads_common.turn = 1;
+		condSignal(test_threads_common.c);
+
+		while (test_threads_common.turn)
+			condWait(test_threads_common.c2, test_threads_common.m, 0);
+
+		test_threads_common.samples[k] = bench_time() - t0;
+	}
+	mutexUnlock(test_threads_common.m);
+
+	bench_exit();
+}
+
+
+static void bench_pongthr(void *arg)
+{
+	unsigned int k;
+
+	mutexLock(test_threads_common.m);
+	for (k = 0; k < test_threads_common.count; k++) {
+		while (!test_threads_common.turn)
+			condWait(test_threads_common.c, test_threads_common.m, 0);
+
+		test_threads_common.turn = 0;
+		condSignal(test_threads_common.c2);
+	}
+	mutexUnlock(test_threads_common.m);
+
+	bench_exit();
+}
+
+
+/* Measures lateness of high priority thread waking up from sleep */
+static void bench_sleeperthr(void *arg)
+{
+	unsigned int k;
+	uint64_t t0, elapsed;
+
+	for (k = 0; k < test_threads_common.count; k++) {
+		t0 = bench_time();
+		usleep(BENCH_PERIOD);
+		elapsed = bench_time() - t0;
+		test_threads_common.samples[k] = (elapsed > BENCH_PERIOD) ? elapsed - BENCH_PERIOD : 0;
+	}
+
+	bench_exit();
+}
+
+
+static int bench_preemption(int busy)
+{
+	test_threads_common.running = 1;
+	test_threads_common.stop = 0;
+
+	if (busy && bench_start(test_threads_busythr, BENCH_PRIO_BUSY) < 0) {
+		printf("test_threads: failed to start busy thread\n");
+		return -1;
+	}
+
+	if (bench_start(bench_sleeperthr, BENCH_PRIO_HIGH) < 0) {
+		printf("test_threads: failed to start sleeper thread\n");
+		return -1;
+	}
+
+	bench_wait();
+	test_threads_common.stop = 1;
+
+	bench_print(busy ? "test_threads/preemption busy" : "test_threads/preemption idle", test_threads_common.samples, test_threads_common.count);
+	bench_histogram(busy ? "test_threads/preemption busy" : "test_threads/preemption idle", test_threads_common.samples, test_threads_common.count);
+
+	/* Let busy thread exit */
+	usleep(10000);
+
+	return 0;
+}
+
+
+/* Spins until stopped, counted in running threads so the next iteration can't start while it still runs */
+static void bench_busythr(void *arg)
+{
+	while (!test_threads_common.stop);
+	bench_exit();
+}
+
+
+/* Holds contended mutex for BENCH_CS us of wall time */
+static void bench_lowthr(void *arg)
+{
+	uint64_t t0;
+
+	mutexLock(test_threads_common.mi);
+
+	mutexLock(test_threads_common.m);
+	test_threads_common.held = 1;
+	condSignal(test_threads_common.c);
+	mutexUnlock(test_threads_common.m);
+
+	for (t0 = bench_time(); bench_time() - t0 < BENCH_CS;);
+
+	mutexUnlock(test_threads_common.mi);
+
+	bench_exit();
+}
+
+
+/* Blocks on mutex held by low priority thread while busy thread starves it */
+static void bench_highthr(void *arg)
+{
+	unsigned int k = (unsigned int)(long)arg;
+	uint64_t t0;
+
+	mutexLock(test_threads_common.m);
+	while (!test_threads_common.held)
+		condWait(test_threads_common.c, test_threads_common.m, 0);
+	mutexUnlock(test_threads_common.m);
+
+	if (bench_start(bench_busythr, BENCH_PRIO_BUSY) < 0) {
+		printf("test_threads: failed to start busy thread\n");
+		bench_done();
+	}
+
+	t0 = bench_time();
+	mutexLock(test_threads_common.mi);
+	test_threads_common.inversion[k] = bench_time() - t0;
+	mutexUnlock(test_threads_common.mi);
+
+	bench_exit();
+}
+
+
+static int bench_inversion(void)
+{
+	unsigned int k;
+	void *stack;
+
+	for (k = 0; k < BENCH_INVERSION; k++) {
+		/* High, low and busy thread started by high one */
+		test_threads_common.running = 3;
+		test_threads_common.held = 0;
+		test_threads_common.stop = 0;
+
+		if ((stack = malloc(BENCH_STACKSZ)) == NULL || beginthread(bench_highthr, BENCH_PRIO_HIGH, stack, BENCH_STACKSZ, (void *)(long)k) < 0 ||
+				bench_start(bench_lowthr, BENCH_PRIO_LOW) < 0) {
+			printf("test_threads: failed to start inversion threads\n");
+			return -1;
+		}
+
+		/* Busy thread gets its budget, then main thread stops it */
+		usleep(BENCH_BUDGET);
+		test_threads_common.stop = 1;
+		bench_wait();
+	}
+
+	printf("test_threads/inversion: critical section %u us, busy thread budget %u us\n", BENCH_CS, BENCH_BUDGET);
+	bench_print("test_threads/inversion", test_threads_common.inversion, BENCH_INVERSION);
+	bench_histogram("test_threads/inversion", test_threads_common.inversion, BENCH_INVERSION);
+
+	return 0;
+}
+
+
+int test_threads_bench(unsigned int count)
+{
+	printf("test_threads: scheduler benchmark, %u samples per test\n", count);
+
+	test_threads_common.count = count;
+	test_threads_common.samples = malloc(count * sizeof(*test_threads_common.samples));
+
+	if (test_threads_common.samples == NULL || mutexCreate(&test_threads_common.m) < 0 || mutexCreate(&test_threads_common.mi) < 0 ||
+			condCreate(&test_threads_common.c) < 0 || condCreate(&test_threads_common.c2) < 0 ||
+			condCreate(&test_threads_common.cdone) < 0) {
+		printf("test_threads: failed to allocate benchmark resources\n");
+		return 1;
+	}
+
+	priority(BENCH_PRIO_MAIN);
+
+	if (bench_run("wakeup", bench_waiterthr, bench_signalerthr, BENCH_PRIO_MID) < 0 ||
+			bench_run("pingpong", bench_pingthr, bench_pongthr, BENCH_PRIO_MID) < 0 ||
+			bench_preemption(0) < 0 || bench_preemption(1) < 0 || bench_inversion() < 0)
+		return 1;
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
 {
 	char *indicator = "o|/-\\|/-\\";
 	unsigned int i = 0;
 	char s[512];
 
+	/* Bounded scheduler benchmark */
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		return test_threads_bench((argc > 2) ? strtoul(argv[2], NULL, 10) : 1000);
+
 	printf("test_threads: Starting, main is at %p\n", main);
 
 	test_threads_threads1();
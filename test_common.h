@@ -19,6 +19,9 @@
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <sys/time.h>
 
 static int test_verbosity;
 
@@ -70,4 +73,70 @@ static inline int verbose_test(void)
 	return test_verbosity;
 }
 
+
+/* Returns monotonic-enough timestamp in usec for benchmarks */
+static inline uint64_t bench_time(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+
+static inline int bench_cmp(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+
+/* Returns pct percentile of sorted samples */
+static inline uint64_t bench_percentile(const uint64_t *samples, unsigned int n, unsigned int pct)
+{
+	return n ? samples[(uint64_t)(n - 1) * pct / 100] : 0;
+}
+
+
+/* Sorts samples and prints their distribution (in usec) */
+static inline void bench_print(const char *name, uint64_t *samples, unsigned int n)
+{
+	uint64_t sum = 0;
+	unsigned int i;
+
+	qsort(samples, n, sizeof(*samples), bench_cmp);
+
+	for (i = 0; i < n; i++)
+		sum += samples[i];
+
+	printf("%s: n %u min %" PRIu64 " p50 %" PRIu64 " p90 %" PRIu64 " p99 %" PRIu64 " max %" PRIu64 " avg %" PRIu64 " [us]\n",
+		name, n, bench_percentile(samples, n, 0), bench_percentile(samples, n, 50), bench_percentile(samples, n, 90),
+		bench_percentile(samples, n, 99), bench_percentile(samples, n, 100), n ? sum / n : 0);
+}
+
+
+/* Prints histogram of sorted samples in power of 2 usec buckets */
+static inline void bench_histogram(const char *name, const uint64_t *samples, unsigned int n)
+{
+	unsigned int i = 0, cnt, bar;
+	uint64_t lo = 0, hi = 1;
+
+	while (i < n) {
+		for (cnt = 0; i < n && samples[i] < hi; i++)
+			cnt++;
+
+		if (cnt != 0) {
+			printf("%s: %8" PRIu64 " - %8" PRIu64 " us %8u ", name, lo, hi - 1, cnt);
+			for (bar = 0; bar < (cnt * 40 + n - 1) / n; bar++)
+				putchar('#');
+			putchar('\n');
+		}
+
+		lo = hi;
+		hi *= 2;
+	}
+}
+
 #endif